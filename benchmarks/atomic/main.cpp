@@ -18,6 +18,31 @@
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_Random.hpp>
 
+// 32 bytes are too large for a compare-and-swap, atomics on this type go
+// through the lock array
+struct LockedScalar {
+  double value[4];
+
+  KOKKOS_FUNCTION LockedScalar(double v = 0) : value{v, v, v, v} {}
+
+  KOKKOS_FUNCTION LockedScalar operator+(LockedScalar const& rhs) const {
+    LockedScalar result;
+    for (int i = 0; i < 4; i++) result.value[i] = value[i] + rhs.value[i];
+    return result;
+  }
+
+  KOKKOS_FUNCTION LockedScalar operator*(LockedScalar const& rhs) const {
+    LockedScalar result;
+    for (int i = 0; i < 4; i++) result.value[i] = value[i] * rhs.value[i];
+    return result;
+  }
+
+  KOKKOS_FUNCTION LockedScalar& operator+=(LockedScalar const& rhs) {
+    for (int i = 0; i < 4; i++) value[i] += rhs.value[i];
+    return *this;
+  }
+};
+
 template <class Scalar>
 double test_atomic(int L, int N, int M, int K, int R,
                    Kokkos::View<const int**> offsets) {
@@ -77,6 +102,7 @@ int main(int argc, char* argv[]) {
       printf("       3 - float\n");
       printf("       4 - double\n");
       printf("       5 - complex<double>\n");
+      printf("       6 - 32-byte struct (lock-based)\n");
       printf("Example Input GPU:\n");
       printf("  Histogram : 1000000 1000 1 1000 1 10 1\n");
       printf("  MD Force : 100000 100000 100 1000 20 10 4\n");
@@ -103,6 +129,7 @@ int main(int argc, char* argv[]) {
     if (type == 4) time = test_atomic<double>(L, N, M, K, R, offsets);
     if (type == 5)
       time = test_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
+    if (type == 6) time = test_atomic<LockedScalar>(L, N, M, K, R, offsets);
 
     double time2 = 1;
     if (type == 1) time2 = test_no_atomic<int>(L, N, M, K, R, offsets);
@@ -111,6 +138,8 @@ int main(int argc, char* argv[]) {
     if (type == 4) time2 = test_no_atomic<double>(L, N, M, K, R, offsets);
     if (type == 5)
       time2 = test_no_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
+    if (type == 6)
+      time2 = test_no_atomic<LockedScalar>(L, N, M, K, R, offsets);
 
     int size = 0;
     if (type == 1) size = sizeof(int);
@@ -118,6 +147,7 @@ int main(int argc, char* argv[]) {
     if (type == 3) size = sizeof(float);
     if (type == 4) size = sizeof(double);
     if (type == 5) size = sizeof(Kokkos::complex<double>);
+    if (type == 6) size = sizeof(LockedScalar);
 
     printf("%i\n", size);
     printf(
@@ -128,7 +158,9 @@ int main(int argc, char* argv[]) {
             : ((type == 2)
                    ? "long"
                    : ((type == 3) ? "float"
-                                  : ((type == 4) ? "double" : "complex"))),
+                                  : ((type == 4) ? "double"
+                                                 : ((type == 5) ? "complex"
+                                                                : "locked")))),
         L, N, M, D, K, R, time, time2, time / time2, 1.e-9 * L * R * M / time,
         1.0 * L * R * M * 2 * size / time / 1024 / 1024 / 1024);
   }
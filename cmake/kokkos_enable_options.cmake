@@ -71,6 +71,8 @@ KOKKOS_ENABLE_OPTION(HIP_MULTIPLE_KERNEL_INSTANTIATIONS OFF "Whether multiple ke
 
 # This option will go away eventually, but allows fallback to old implementation when needed.
 KOKKOS_ENABLE_OPTION(DESUL_ATOMICS_EXTERNAL OFF "Whether to use an external desul installation")
+KOKKOS_OPTION(IMPL_DESUL_HOST_LOCK_ARRAY_SIZE 65536 STRING "Number of locks (a power of two) used by lock-based host atomics of the internal desul copy, each on its own 64-byte cache line")
+mark_as_advanced(Kokkos_IMPL_DESUL_HOST_LOCK_ARRAY_SIZE)
 
 KOKKOS_ENABLE_OPTION(IMPL_MDSPAN OFF "Whether to enable experimental mdspan support")
 KOKKOS_ENABLE_OPTION(MDSPAN_EXTERNAL OFF BOOL "Whether to use an external version of mdspan")
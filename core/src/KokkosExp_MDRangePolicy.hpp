@@ -128,6 +128,16 @@ constexpr NVCC_WONT_LET_ME_CALL_YOU_Array to_array_potentially_narrowing(
   return a;
 }
 
+// rank of a StaticTile, without instantiating it when the policy has none
+template <class StaticTile>
+constexpr int static_tile_rank() {
+  if constexpr (std::is_void<StaticTile>::value) {
+    return 0;
+  } else {
+    return StaticTile::rank;
+  }
+}
+
 struct TileSizeProperties {
   int max_threads;
   int default_largest_tile_size;
@@ -174,9 +184,13 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   using work_tag          = typename traits::work_tag;
   using launch_bounds     = typename traits::launch_bounds;
   using member_type       = typename range_policy::member_type;
+  using static_tile       = typename traits::static_tile;
 
   static constexpr int rank = iteration_pattern::rank;
   static_assert(rank < 7, "Kokkos MDRangePolicy Error: Unsupported rank...");
+  static_assert(std::is_void<static_tile>::value ||
+                    Impl::static_tile_rank<static_tile>() == rank,
+                "Kokkos MDRangePolicy Error: StaticTile rank does not match");
 
   using index_type       = typename traits::index_type;
   using array_index_type = std::int64_t;
@@ -200,6 +214,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   index_type m_num_tiles      = 1;
   index_type m_prod_tile_dims = 1;
   bool m_tune_tile_size       = false;
+  Kokkos::Experimental::TileOrder m_tile_order =
+      Kokkos::Experimental::TileOrder::Default;
 
   static constexpr auto outer_direction =
       (iteration_pattern::outer_direction != Iterate::Default)
@@ -306,7 +322,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_tile_end(p.m_tile_end),
         m_num_tiles(p.m_num_tiles),
         m_prod_tile_dims(p.m_prod_tile_dims),
-        m_tune_tile_size(p.m_tune_tile_size) {}
+        m_tune_tile_size(p.m_tune_tile_size),
+        m_tile_order(p.m_tile_order) {}
 
   void impl_change_tile_size(const point_type& tile) {
     m_tile = tile;
@@ -314,6 +331,17 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   }
   bool impl_tune_tile_size() const { return m_tune_tile_size; }
 
+  /** \brief Order in which the host backends hand out the tiles, both in the
+   *         static block of each thread and in the dynamic schedule. Morton
+   *         and Hilbert orders keep consecutive tiles close to each other in
+   *         all dimensions. Ignored by device backends.
+   */
+  MDRangePolicy& set_tile_order(Kokkos::Experimental::TileOrder order) {
+    m_tile_order = order;
+    return *this;
+  }
+  Kokkos::Experimental::TileOrder tile_order() const { return m_tile_order; }
+
  private:
   void init_helper(Impl::TileSizeProperties properties) {
     m_prod_tile_dims = 1;
@@ -327,6 +355,16 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
     }
     for (int i = rank_start; i != rank_end; i += increment) {
       const index_type length = m_upper[i] - m_lower[i];
+      if constexpr (!std::is_void<static_tile>::value) {
+        const auto extent =
+            static_cast<array_index_type>(static_tile::extents[i]);
+        if (m_tile[i] > 0 && m_tile[i] != extent) {
+          Kokkos::abort(
+              "Kokkos::MDRangePolicy: tile dims do not match the StaticTile "
+              "extents");
+        }
+        m_tile[i] = extent;
+      }
       if (m_tile[i] <= 0) {
         m_tune_tile_size = true;
         if ((inner_direction == Iterate::Right && (i < rank - 1)) ||
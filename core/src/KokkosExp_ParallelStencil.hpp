@@ -0,0 +1,213 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_EXP_PARALLEL_STENCIL_HPP
+#define KOKKOS_EXP_PARALLEL_STENCIL_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <KokkosExp_MDRangePolicy.hpp>
+#include <Kokkos_View.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// Calls the stencil functor on the points of a tile for one time step
+template <class Functor, class WorkTag>
+struct ParallelStencilStep {
+  const Functor& m_functor;
+  int m_step;
+
+  template <class... Indices>
+  void operator()(Indices... indices) const {
+    if constexpr (std::is_void<WorkTag>::value) {
+      m_functor(m_step, indices...);
+    } else {
+      m_functor(WorkTag(), m_step, indices...);
+    }
+  }
+};
+
+// Runs the time steps of one block on one slab of the grid, see
+// parallel_stencil
+template <class Policy, class Functor>
+struct ParallelStencilSlabs {
+  using execution_space  = typename Policy::execution_space;
+  using array_index_type = typename Policy::array_index_type;
+  using point_type       = typename Policy::point_type;
+  using step_type = ParallelStencilStep<Functor, typename Policy::work_tag>;
+
+  // Slabs are cut along the dimension whose index strides slowest
+  static constexpr int slab_dim =
+      Policy::outer_direction == Iterate::Left ? Policy::rank - 1 : 0;
+
+  Policy m_policy;
+  Functor m_functor;
+  array_index_type m_radius;
+  array_index_type m_width;
+  array_index_type m_num_slabs;
+  // time steps of the current block
+  int m_step_begin = 0;
+  int m_step_end   = 0;
+  // number of time steps each slab has completed
+  View<int*, typename execution_space::memory_space> m_progress;
+  // number of slabs claimed over all the blocks
+  View<array_index_type, typename execution_space::memory_space> m_claimed;
+
+  ParallelStencilSlabs(const Policy& policy, const Functor& functor)
+      : m_policy(policy),
+        m_functor(functor),
+        m_radius(functor.radius),
+        m_width(policy.m_tile[slab_dim]),
+        m_num_slabs(policy.m_tile_end[slab_dim]),
+        m_progress("Kokkos::parallel_stencil::progress", m_num_slabs),
+        m_claimed("Kokkos::parallel_stencil::claimed") {}
+
+  // Largest number of time steps per block, for which the slabs move back by
+  // at most their width
+  static int max_steps_per_block(const Policy& policy, const Functor& functor) {
+    const array_index_type radius = functor.radius;
+    return radius > 0 ? std::max<int>(policy.m_tile[slab_dim] / radius, 1)
+                      : std::numeric_limits<int>::max();
+  }
+
+  // Lower bound of the slab at the given time step of a block. The bounds
+  // move back by the radius at each step so that a slab depends only on the
+  // steps the previous slab has already completed.
+  array_index_type slab_begin(array_index_type slab, int block_step) const {
+    const array_index_type lower = m_policy.m_lower[slab_dim];
+    const array_index_type upper = m_policy.m_upper[slab_dim];
+    if (slab == m_num_slabs) return upper;
+    return std::clamp<array_index_type>(
+        lower + slab * m_width - block_step * m_radius, lower, upper);
+  }
+
+  void operator()(const array_index_type) const {
+    // Slabs are claimed in increasing order whatever the schedule of the
+    // backend, so the slabs a slab waits for are all running already. Each
+    // block claims every slab once.
+    const array_index_type slab =
+        Kokkos::atomic_fetch_add(&m_claimed(), array_index_type(1)) %
+        m_num_slabs;
+    for (int step = m_step_begin; step < m_step_end; ++step) {
+      if (slab > 0 && step > m_step_begin) {
+        // wait for the previous slab to complete the preceding step
+        spinwait_while_equal<int>(m_progress(slab - 1), step - 1);
+      }
+
+      point_type lower = m_policy.m_lower;
+      point_type upper = m_policy.m_upper;
+      lower[slab_dim]  = slab_begin(slab, step - m_step_begin);
+      upper[slab_dim]  = slab_begin(slab + 1, step - m_step_begin);
+      if (lower[slab_dim] < upper[slab_dim]) {
+        const Policy region(m_policy.space(), lower, upper, m_policy.m_tile);
+        const step_type functor{m_functor, step};
+        const HostIterateTile<Policy, step_type> iterate(region, functor);
+        for (array_index_type tile = 0; tile < region.m_num_tiles; ++tile) {
+          iterate(tile);
+        }
+      }
+
+      Kokkos::memory_fence();
+      Kokkos::atomic_increment(&m_progress(slab));
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Runs num_steps sweeps of an iterative stencil over the points of an
+/// MDRangePolicy, blocked in time so that data stays in cache across steps.
+///
+/// The functor is called as functor(step, i0, ..., iN), after the work tag if
+/// the policy has one, and computes the value of time step + 1 at the point
+/// from values of time step at most functor.radius points away in each
+/// dimension. Consecutive time steps must be stored in different buffers,
+/// e.g. time t in buffer t % 2 as for Jacobi iterations.
+///
+/// The grid is cut into slabs along the slowest striding dimension, as wide as
+/// the tile of the policy in that dimension, and the time steps into blocks
+/// of steps_per_block steps. Within a block, each slab runs the steps in a
+/// row over its own points, tile by tile as in an MDRange parallel_for, and
+/// its bounds move back by the radius at each step (time skewing). A slab thus
+/// only waits for the previous slab to complete the preceding step, and the
+/// slabs are pipelined across the threads of the host execution space. All
+/// the slabs complete a block before the next one starts, from unskewed
+/// bounds. steps_per_block is at most the slab width divided by the radius,
+/// which is the default, so that slabs move back by at most their width.
+template <class... Properties, class Functor>
+void parallel_stencil(const std::string& label,
+                      const MDRangePolicy<Properties...>& policy,
+                      const int num_steps, const int steps_per_block,
+                      const Functor& functor) {
+  using policy_type  = MDRangePolicy<Properties...>;
+  using closure_type = Kokkos::Impl::ParallelStencilSlabs<policy_type, Functor>;
+  using execution_space = typename policy_type::execution_space;
+  static_assert(
+      SpaceAccessibility<execution_space, HostSpace>::accessible,
+      "Kokkos::Experimental::parallel_stencil requires a host execution space");
+
+  if (steps_per_block < 1 ||
+      steps_per_block > closure_type::max_steps_per_block(policy, functor)) {
+    Kokkos::abort(
+        "Kokkos::Experimental::parallel_stencil: steps_per_block must be "
+        "between one and the slab width divided by the radius");
+  }
+  closure_type closure(policy, functor);
+  // one launch per block, which completes before the next one starts
+  for (int step = 0; step < num_steps; step += steps_per_block) {
+    closure.m_step_begin = step;
+    closure.m_step_end   = std::min(num_steps - step, steps_per_block) + step;
+    Kokkos::parallel_for(
+        label,
+        RangePolicy<execution_space, Schedule<Dynamic>,
+                    IndexType<typename closure_type::array_index_type>>(
+            policy.space(), 0, closure.m_num_slabs, ChunkSize(1)),
+        closure);
+  }
+}
+
+template <class... Properties, class Functor>
+void parallel_stencil(const std::string& label,
+                      const MDRangePolicy<Properties...>& policy,
+                      const int num_steps, const Functor& functor) {
+  using closure_type =
+      Kokkos::Impl::ParallelStencilSlabs<MDRangePolicy<Properties...>,
+                                         Functor>;
+  parallel_stencil(
+      label, policy, num_steps,
+      std::min(std::max(num_steps, 1),
+               closure_type::max_steps_per_block(policy, functor)),
+      functor);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_EXP_PARALLEL_STENCIL_HPP
@@ -0,0 +1,307 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_EXP_WEIGHTED_RANGE_POLICY_HPP
+#define KOKKOS_EXP_WEIGHTED_RANGE_POLICY_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_View.hpp>
+#include <impl/Kokkos_AnalyzePolicy.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// Bounds of the contiguous range of each part, part p runs the iterations
+// [bounds(p), bounds(p + 1))
+template <class Index>
+using WeightedRangeBounds = View<Index*, HostSpace>;
+
+// Splits [begin, end) into num_parts contiguous ranges of about the same total
+// cost, from the prefix sum of the costs
+template <class ExecutionSpace, class Index, class CostFunctor>
+WeightedRangeBounds<Index> weighted_range_partition(
+    const ExecutionSpace& space, const Index begin, const Index end,
+    const int num_parts, const CostFunctor& cost) {
+  const Index length = end > begin ? end - begin : 0;
+  View<double*, HostSpace> prefix(
+      view_alloc(WithoutInitializing, "Kokkos::WeightedRangePolicy::prefix"),
+      length + 1);
+  prefix(0) = 0;
+  Kokkos::parallel_scan(
+      "Kokkos::WeightedRangePolicy::prefix_sum",
+      RangePolicy<ExecutionSpace, IndexType<Index>>(space, 0, length),
+      [=](const Index i, double& update, const bool final) {
+        update += static_cast<double>(cost(begin + i));
+        if (final) prefix(i + 1) = update;
+      });
+  space.fence("Kokkos::WeightedRangePolicy: fence after prefix sum");
+
+  WeightedRangeBounds<Index> bounds(
+      view_alloc(WithoutInitializing, "Kokkos::WeightedRangePolicy::bounds"),
+      num_parts + 1);
+  const double total = prefix(length);
+  bounds(0)          = begin;
+  for (int part = 1; part < num_parts; ++part) {
+    // first iteration whose cost ends past the share of the previous parts
+    const double share = total * part / num_parts;
+    const double* last = std::upper_bound(prefix.data() + 1,
+                                          prefix.data() + length + 1, share);
+    bounds(part) = std::max(bounds(part - 1),
+                            begin + Index(last - (prefix.data() + 1)));
+  }
+  bounds(num_parts) = begin + length;
+  return bounds;
+}
+
+// Partitions computed from cost Views, reused while the View, the range, the
+// number of parts and the version of the costs given by the caller are
+// unchanged. An allocation freed and reused for other costs can only make a
+// reused partition less balanced, never wrong.
+template <class Index>
+class WeightedRangeCache {
+  using key_type =
+      std::tuple<const void*, size_t, Index, Index, int, std::uint64_t>;
+
+  std::mutex m_mutex;
+  std::map<key_type, WeightedRangeBounds<Index>> m_bounds;
+  bool m_hook_pushed = false;
+
+  // keep the cache from growing without bound with temporary cost Views
+  static constexpr size_t max_entries = 64;
+
+ public:
+  static WeightedRangeCache& singleton() {
+    static WeightedRangeCache cache;
+    return cache;
+  }
+
+  template <class Compute>
+  WeightedRangeBounds<Index> get(const key_type& key, bool update,
+                                 const Compute& compute) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_bounds.find(key);
+    if (found != m_bounds.end() && !update) return found->second;
+
+    auto bounds = compute();
+    if (m_bounds.size() >= max_entries) m_bounds.clear();
+    m_bounds[key] = bounds;
+    if (!m_hook_pushed) {
+      // the bounds are Views which must not outlive Kokkos
+      Kokkos::push_finalize_hook([] {
+        auto& cache = singleton();
+        std::lock_guard<std::mutex> hook_lock(cache.m_mutex);
+        cache.m_bounds.clear();
+        cache.m_hook_pushed = false;
+      });
+      m_hook_pushed = true;
+    }
+    return bounds;
+  }
+};
+
+// Runs the iterations of one part of a WeightedRangePolicy
+template <class Functor, class WorkTag, class Index>
+struct WeightedRangeFor {
+  Functor m_functor;
+  WeightedRangeBounds<Index> m_bounds;
+
+  void operator()(const int part) const {
+    const Index end = m_bounds(part + 1);
+    for (Index i = m_bounds(part); i < end; ++i) {
+      if constexpr (std::is_void<WorkTag>::value) {
+        m_functor(i);
+      } else {
+        m_functor(WorkTag(), i);
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Range of iterations split into one contiguous range per thread of
+/// a host execution space, balanced by the cost of the iterations instead of
+/// their number.
+///
+/// The costs are given by a rank one View indexed like the iterations, or by
+/// a functor called as cost(i), and are summed when the policy is made. A
+/// policy over a View made with a cost_version caches its partition, later
+/// policies over the same View, range and version reuse it; pass a new
+/// version after modifying the costs in place. Every thread runs its range in
+/// order, so data it touches first stays close to it from one launch to the
+/// next.
+template <class... Properties>
+class WeightedRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
+ public:
+  using traits          = Kokkos::Impl::PolicyTraits<Properties...>;
+  using execution_space = typename traits::execution_space;
+  using index_type      = typename traits::index_type;
+  using member_type     = index_type;
+  using work_tag        = typename traits::work_tag;
+
+  static_assert(
+      SpaceAccessibility<execution_space, HostSpace>::accessible,
+      "Kokkos::Experimental::WeightedRangePolicy requires a host execution "
+      "space");
+
+  template <class CostType>
+  WeightedRangePolicy(const execution_space& space, const index_type begin,
+                      const index_type end, const CostType& cost)
+      : m_space(space),
+        m_begin(begin),
+        m_end(end),
+        m_num_parts(std::max(space.concurrency(), 1)) {
+    set_costs(cost, false);
+  }
+
+  template <class CostType>
+  WeightedRangePolicy(const index_type begin, const index_type end,
+                      const CostType& cost)
+      : WeightedRangePolicy(execution_space(), begin, end, cost) {}
+
+  /** \brief partition cached for the cost View and cost_version, which the
+   *  caller changes whenever it modifies the costs in place */
+  template <class CostType>
+  WeightedRangePolicy(const execution_space& space, const index_type begin,
+                      const index_type end, const CostType& cost,
+                      const std::uint64_t cost_version)
+      : m_space(space),
+        m_begin(begin),
+        m_end(end),
+        m_num_parts(std::max(space.concurrency(), 1)),
+        m_cached(true),
+        m_cost_version(cost_version) {
+    static_assert(Kokkos::is_view<CostType>::value,
+                  "Kokkos::Experimental::WeightedRangePolicy: only partitions "
+                  "of cost Views are cached");
+    set_costs(cost, false);
+  }
+
+  template <class CostType>
+  WeightedRangePolicy(const index_type begin, const index_type end,
+                      const CostType& cost, const std::uint64_t cost_version)
+      : WeightedRangePolicy(execution_space(), begin, end, cost,
+                            cost_version) {}
+
+  /** \brief recompute the partition from costs modified in place */
+  template <class CostType>
+  WeightedRangePolicy& update_costs(const CostType& cost) {
+    set_costs(cost, true);
+    return *this;
+  }
+
+  const execution_space& space() const { return m_space; }
+  index_type begin() const { return m_begin; }
+  index_type end() const { return m_end; }
+  int num_parts() const { return m_num_parts; }
+
+  /** \brief bounds of the range of each part, part p runs the iterations
+   *  [bounds(p), bounds(p + 1)) */
+  const Kokkos::Impl::WeightedRangeBounds<index_type>& impl_bounds() const {
+    return m_bounds;
+  }
+
+ private:
+  execution_space m_space;
+  index_type m_begin;
+  index_type m_end;
+  int m_num_parts;
+  bool m_cached                = false;
+  std::uint64_t m_cost_version = 0;
+  Kokkos::Impl::WeightedRangeBounds<index_type> m_bounds;
+
+  template <class CostType>
+  void set_costs(const CostType& cost, const bool update) {
+    if constexpr (Kokkos::is_view<CostType>::value) {
+      static_assert(CostType::rank == 1,
+                    "Kokkos::Experimental::WeightedRangePolicy: the cost View "
+                    "must be of rank one");
+      static_assert(
+          SpaceAccessibility<HostSpace,
+                             typename CostType::memory_space>::accessible,
+          "Kokkos::Experimental::WeightedRangePolicy: the cost View must be "
+          "accessible from the host");
+      if (m_begin < m_end && size_t(m_end) > cost.extent(0)) {
+        Kokkos::abort(
+            "Kokkos::Experimental::WeightedRangePolicy: the cost View is "
+            "shorter than the range");
+      }
+      if (m_cached) {
+        m_bounds =
+            Kokkos::Impl::WeightedRangeCache<index_type>::singleton().get(
+                {cost.data(), cost.extent(0), m_begin, m_end, m_num_parts,
+                 m_cost_version},
+                update, [&] {
+                  return Kokkos::Impl::weighted_range_partition(
+                      m_space, m_begin, m_end, m_num_parts, cost);
+                });
+        return;
+      }
+    }
+    m_bounds = Kokkos::Impl::weighted_range_partition(m_space, m_begin, m_end,
+                                                      m_num_parts, cost);
+  }
+};
+
+}  // namespace Experimental
+
+template <class... Properties, class Functor>
+void parallel_for(
+    const std::string& label,
+    const Experimental::WeightedRangePolicy<Properties...>& policy,
+    const Functor& functor) {
+  using policy_type = Experimental::WeightedRangePolicy<Properties...>;
+  using closure_type =
+      Kokkos::Impl::WeightedRangeFor<Functor, typename policy_type::work_tag,
+                                     typename policy_type::index_type>;
+  using execution_space = typename policy_type::execution_space;
+
+  // one part per thread, handed out in order by the static schedule
+  Kokkos::parallel_for(
+      label,
+      RangePolicy<execution_space, Schedule<Static>, IndexType<int>>(
+          policy.space(), 0, policy.num_parts(), ChunkSize(1)),
+      closure_type{functor, policy.impl_bounds()});
+}
+
+template <class... Properties, class Functor>
+void parallel_for(
+    const Experimental::WeightedRangePolicy<Properties...>& policy,
+    const Functor& functor) {
+  Kokkos::parallel_for("", policy, functor);
+}
+
+}  // namespace Kokkos
+
+#endif  // KOKKOS_EXP_WEIGHTED_RANGE_POLICY_HPP
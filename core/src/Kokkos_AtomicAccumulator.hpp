@@ -0,0 +1,178 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_ATOMIC_ACCUMULATOR_HPP
+#define KOKKOS_ATOMIC_ACCUMULATOR_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_HostChunkScope.hpp>
+#include <impl/Kokkos_Utilities.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class AtomicAccumulator
+/// \brief Combines additions to the same address in a private buffer and
+/// applies them with one atomic_add per distinct address.
+///
+/// An AtomicAccumulator is a local variable of a kernel body and combines
+/// the updates made within one call of the body, e.g. a chunk of iterations
+/// or a team member of a TeamPolicy. accumulated_atomic_add below combines
+/// the updates of all the iterations a host thread runs instead.
+///
+/// \code
+///   parallel_for(num_chunks, KOKKOS_LAMBDA(int chunk) {
+///     Kokkos::Experimental::AtomicAccumulator<int> acc;
+///     for (int i = chunk * chunk_size; i < (chunk + 1) * chunk_size; ++i)
+///       acc.add(&histogram(bin(i)), 1);
+///   });  // the destructor flushes
+/// \endcode
+///
+/// The buffer holds up to Capacity distinct addresses. Adding to a new
+/// address while it is full flushes the entries in round robin order. Until
+/// flush() is called (or the accumulator is destroyed) the buffered values
+/// are not visible to other threads.
+template <class T, int Capacity = 8>
+class AtomicAccumulator {
+  static_assert(Capacity > 0, "AtomicAccumulator requires a capacity > 0");
+
+  T* m_address[Capacity];
+  T m_value[Capacity];
+  int m_size = 0;
+  int m_evict = 0;
+
+ public:
+  using value_type = T;
+
+  KOKKOS_FUNCTION AtomicAccumulator() {}
+  KOKKOS_FUNCTION ~AtomicAccumulator() { flush(); }
+
+  // copies would apply the buffered updates twice
+  AtomicAccumulator(AtomicAccumulator const&) = delete;
+  AtomicAccumulator& operator=(AtomicAccumulator const&) = delete;
+
+  KOKKOS_FUNCTION static constexpr int capacity() { return Capacity; }
+  /// Number of distinct addresses with buffered updates
+  KOKKOS_FUNCTION int size() const { return m_size; }
+
+  KOKKOS_FUNCTION void add(T* address, T const& value) {
+    for (int i = 0; i < m_size; ++i) {
+      if (m_address[i] == address) {
+        m_value[i] += value;
+        return;
+      }
+    }
+    if (m_size < Capacity) {
+      m_address[m_size] = address;
+      m_value[m_size]   = value;
+      ++m_size;
+      return;
+    }
+    Kokkos::atomic_add(m_address[m_evict], m_value[m_evict]);
+    m_address[m_evict] = address;
+    m_value[m_evict]   = value;
+    m_evict            = m_evict + 1 == Capacity ? 0 : m_evict + 1;
+  }
+
+  /// Applies all buffered updates and empties the buffer
+  KOKKOS_FUNCTION void flush() {
+    for (int i = 0; i < m_size; ++i) {
+      Kokkos::atomic_add(m_address[i], m_value[i]);
+    }
+    m_size  = 0;
+    m_evict = 0;
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+// The buffer of the calling host thread for accumulated_atomic_add
+template <class T, int Capacity>
+class HostAtomicAccumulator {
+  struct State {
+    Kokkos::Experimental::AtomicAccumulator<T, Capacity> buffer;
+    bool registered = false;
+  };
+
+  static State& state() {
+    thread_local State s;
+    return s;
+  }
+
+  static void flush() {
+    State& s = state();
+    s.buffer.flush();
+    s.registered = false;
+  }
+
+ public:
+  static void add(T* address, T const& value) {
+    if (!HostChunkScope::active()) {
+      Kokkos::atomic_add(address, value);
+      return;
+    }
+    State& s = state();
+    if (!s.registered) {
+      HostChunkScope::on_close(&flush);
+      s.registered = true;
+    }
+    s.buffer.add(address, value);
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Adds value to *address like atomic_add, combining the updates of
+/// all the iterations the calling thread runs.
+///
+/// In a RangePolicy parallel_for of the Serial, OpenMP and Threads backends,
+/// every host thread keeps an AtomicAccumulator<T, Capacity> of its own, which
+/// is flushed with one atomic_add per distinct address when the thread has
+/// run its share of the iterations, before the kernel completes. Kernels that
+/// increment a few hot counters or histogram bins then issue a few atomics
+/// per thread instead of one per iteration:
+///
+/// \code
+///   parallel_for(n, KOKKOS_LAMBDA(int i) {
+///     Kokkos::Experimental::accumulated_atomic_add(&histogram(bin(i)), 1);
+///   });
+/// \endcode
+///
+/// The updates are not visible to other threads before the end of the
+/// kernel, so they must not be read in the same kernel. Elsewhere, on other
+/// backends and policies and on devices, this is an atomic_add.
+template <int Capacity = 8, class T>
+KOKKOS_FUNCTION void accumulated_atomic_add(
+    T* address, Kokkos::Impl::type_identity_t<T> const& value) {
+  KOKKOS_IF_ON_HOST(
+      (Kokkos::Impl::HostAtomicAccumulator<T, Capacity>::add(address, value);))
+  KOKKOS_IF_ON_DEVICE((Kokkos::atomic_add(address, value);))
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -25,7 +25,9 @@ static_assert(false,
 #include <Kokkos_Parallel.hpp>
 #include <KokkosExp_MDRangePolicy.hpp>
 #include <Kokkos_Layout.hpp>
+#include <Kokkos_Half.hpp>
 #include <impl/Kokkos_HostSpace_ZeroMemset.hpp>
+#include <impl/Kokkos_Half_BulkConversion.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -707,6 +709,156 @@ void view_copy(const DstType& dst, const SrcType& src) {
   }
 }
 
+// Value type pairs that deep_copy converts with the bulk half precision
+// kernels. They only exist when half_t/bhalf_t are 16-bit types, otherwise
+// they are float and the copy is a plain memcpy.
+template <class DstValueType, class SrcValueType>
+struct ViewHalfConversion {
+  static constexpr bool value = false;
+};
+
+#if !KOKKOS_HALF_T_IS_FLOAT
+template <>
+struct ViewHalfConversion<float, Kokkos::Experimental::half_t> {
+  static constexpr bool value = true;
+  static void convert(float* dst, Kokkos::Experimental::half_t const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::half_t) == 2);
+    convert_half_to_float(reinterpret_cast<std::uint16_t const*>(src), dst, n);
+  }
+};
+
+template <>
+struct ViewHalfConversion<Kokkos::Experimental::half_t, float> {
+  static constexpr bool value = true;
+  static void convert(Kokkos::Experimental::half_t* dst, float const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::half_t) == 2);
+    convert_float_to_half(src, reinterpret_cast<std::uint16_t*>(dst), n);
+  }
+};
+
+template <>
+struct ViewHalfConversion<double, Kokkos::Experimental::half_t> {
+  static constexpr bool value = true;
+  static void convert(double* dst, Kokkos::Experimental::half_t const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::half_t) == 2);
+    convert_half_to_double(reinterpret_cast<std::uint16_t const*>(src), dst,
+                           n);
+  }
+};
+
+template <>
+struct ViewHalfConversion<Kokkos::Experimental::half_t, double> {
+  static constexpr bool value = true;
+  static void convert(Kokkos::Experimental::half_t* dst, double const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::half_t) == 2);
+    convert_double_to_half(src, reinterpret_cast<std::uint16_t*>(dst), n);
+  }
+};
+#endif
+
+#if !KOKKOS_BHALF_T_IS_FLOAT
+template <>
+struct ViewHalfConversion<float, Kokkos::Experimental::bhalf_t> {
+  static constexpr bool value = true;
+  static void convert(float* dst, Kokkos::Experimental::bhalf_t const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::bhalf_t) == 2);
+    convert_bhalf_to_float(reinterpret_cast<std::uint16_t const*>(src), dst,
+                           n);
+  }
+};
+
+template <>
+struct ViewHalfConversion<Kokkos::Experimental::bhalf_t, float> {
+  static constexpr bool value = true;
+  static void convert(Kokkos::Experimental::bhalf_t* dst, float const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::bhalf_t) == 2);
+    convert_float_to_bhalf(src, reinterpret_cast<std::uint16_t*>(dst), n);
+  }
+};
+
+template <>
+struct ViewHalfConversion<double, Kokkos::Experimental::bhalf_t> {
+  static constexpr bool value = true;
+  static void convert(double* dst, Kokkos::Experimental::bhalf_t const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::bhalf_t) == 2);
+    convert_bhalf_to_double(reinterpret_cast<std::uint16_t const*>(src), dst,
+                            n);
+  }
+};
+
+template <>
+struct ViewHalfConversion<Kokkos::Experimental::bhalf_t, double> {
+  static constexpr bool value = true;
+  static void convert(Kokkos::Experimental::bhalf_t* dst, double const* src,
+                      std::size_t n) {
+    static_assert(sizeof(Kokkos::Experimental::bhalf_t) == 2);
+    convert_double_to_bhalf(src, reinterpret_cast<std::uint16_t*>(dst), n);
+  }
+};
+#endif
+
+// Copies between host accessible Views with the same contiguous layout whose
+// value types are listed in ViewHalfConversion, on a host execution space
+// instance. Returns false without copying anything if the Views do not
+// qualify.
+template <class ExecutionSpace, class DstType, class SrcType>
+bool view_copy_half_conversion(const ExecutionSpace& space, const DstType& dst,
+                               const SrcType& src) {
+  using conversion =
+      ViewHalfConversion<typename DstType::non_const_value_type,
+                         typename SrcType::non_const_value_type>;
+  constexpr bool host_accessible =
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 Kokkos::HostSpace>::accessible &&
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 typename DstType::memory_space>::accessible &&
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 typename SrcType::memory_space>::accessible;
+  if constexpr (conversion::value && host_accessible) {
+    if (!dst.span_is_contiguous() || !src.span_is_contiguous()) return false;
+    if (!std::is_same<typename DstType::array_layout,
+                      typename SrcType::array_layout>::value &&
+        DstType::rank != 1)
+      return false;
+    size_t dst_strides[DstType::rank + 1];
+    size_t src_strides[SrcType::rank + 1];
+    dst.stride(dst_strides);
+    src.stride(src_strides);
+    for (size_t r = 0; r < DstType::rank; ++r) {
+      if (dst_strides[r] != src_strides[r]) return false;
+    }
+
+    // every chunk is converted by one call so that it stays in the vector
+    // loop of the conversion kernel
+    constexpr size_t chunk_size = 8192;
+    size_t const n              = dst.span();
+    auto* const dst_ptr         = dst.data();
+    auto const* const src_ptr   = src.data();
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-HalfConversion",
+        Kokkos::RangePolicy<ExecutionSpace>(space, 0,
+                                            (n + chunk_size - 1) / chunk_size),
+        [=](size_t chunk) {
+          size_t const begin = chunk * chunk_size;
+          conversion::convert(dst_ptr + begin, src_ptr + begin,
+                              Kokkos::min(chunk_size, n - begin));
+        });
+    return true;
+  } else {
+    (void)space;
+    (void)dst;
+    (void)src;
+    return false;
+  }
+}
+
 template <class DstType, class SrcType, int Rank, class... Args>
 struct CommonSubview;
 
@@ -1769,7 +1921,10 @@ inline void deep_copy(
   } else {
     Kokkos::fence(
         "Kokkos::deep_copy: copy between contiguous views, pre copy fence");
-    Impl::view_copy(dst, src);
+    if (!Impl::view_copy_half_conversion(Kokkos::DefaultHostExecutionSpace(),
+                                         dst, src)) {
+      Impl::view_copy(dst, src);
+    }
     Kokkos::fence(
         "Kokkos::deep_copy: copy between contiguous views, post copy fence");
   }
@@ -2914,7 +3069,9 @@ inline void deep_copy(
     // Copying data between views in accessible memory spaces and either
     // non-contiguous or incompatible shape.
     if (ExecCanAccessSrcDst) {
-      Impl::view_copy(exec_space, dst, src);
+      if (!Impl::view_copy_half_conversion(exec_space, dst, src)) {
+        Impl::view_copy(exec_space, dst, src);
+      }
     } else if (DstExecCanAccessSrc || SrcExecCanAccessDst) {
       using cpy_exec_space =
           std::conditional_t<DstExecCanAccessSrc, dst_execution_space,
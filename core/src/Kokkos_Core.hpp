@@ -59,6 +59,7 @@
 #include <Kokkos_View.hpp>
 #include <Kokkos_Vectorization.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <Kokkos_AtomicAccumulator.hpp>
 #include <Kokkos_hwloc.hpp>
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_Tuners.hpp>
@@ -291,6 +292,8 @@ std::vector<ExecSpace> partition_space(ExecSpace const& space,
 
 #include <Kokkos_Crs.hpp>
 #include <Kokkos_WorkGraphPolicy.hpp>
+#include <KokkosExp_ParallelStencil.hpp>
+#include <KokkosExp_WeightedRangePolicy.hpp>
 // Including this in Kokkos_Parallel_Reduce.hpp led to a circular dependency
 // because Kokkos::Sum is used in Kokkos_Combined_Reducer.hpp and the default.
 // The real answer is to finally break up Kokkos_Parallel_Reduce.hpp into
@@ -74,6 +74,8 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   typename traits::index_type m_end;
   typename traits::index_type m_granularity;
   typename traits::index_type m_granularity_mask;
+  bool m_auto_chunk_size  = true;
+  bool m_dynamic_schedule = false;
 
   template <class... OtherProperties>
   friend class RangePolicy;
@@ -104,7 +106,9 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
         m_begin(p.m_begin),
         m_end(p.m_end),
         m_granularity(p.m_granularity),
-        m_granularity_mask(p.m_granularity_mask) {}
+        m_granularity_mask(p.m_granularity_mask),
+        m_auto_chunk_size(p.m_auto_chunk_size),
+        m_dynamic_schedule(p.m_dynamic_schedule && impl_auto_schedule()) {}
 
   inline RangePolicy()
       : m_space(),
@@ -168,6 +172,7 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   inline void set(const ChunkSize& chunksize, Args... args) {
     m_granularity      = chunksize.value;
     m_granularity_mask = m_granularity - 1;
+    m_auto_chunk_size  = false;
     set(args...);
   }
 
@@ -179,9 +184,38 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   inline RangePolicy& set_chunk_size(int chunk_size) {
     m_granularity      = chunk_size;
     m_granularity_mask = m_granularity - 1;
+    m_auto_chunk_size  = false;
     return *this;
   }
 
+  /** \brief whether the chunk size was chosen by Kokkos, not the user */
+  inline bool impl_auto_chunk_size() const { return m_auto_chunk_size; }
+
+  /** \brief whether the schedule was left to Kokkos, not given as trait */
+  static constexpr bool impl_auto_schedule() {
+    return traits::schedule_type_is_defaulted;
+  }
+
+  /** \brief whether iterations are handed out dynamically, because of the
+   *  Schedule<Dynamic> trait or, without a schedule trait, because it was
+   *  chosen at run time */
+  inline bool impl_dynamic_schedule() const {
+    return std::is_same<typename traits::schedule_type::type,
+                        Kokkos::Dynamic>::value ||
+           m_dynamic_schedule;
+  }
+
+  /** \brief set the chunk size chosen by tuning, keeping it automatic */
+  inline void impl_set_chunk_size(int chunk_size) {
+    m_granularity      = chunk_size;
+    m_granularity_mask = m_granularity - 1;
+  }
+
+  /** \brief choose the schedule of a policy without a schedule trait */
+  inline void impl_set_dynamic_schedule(bool dynamic) {
+    m_dynamic_schedule = dynamic && impl_auto_schedule();
+  }
+
  private:
   /** \brief finalize chunk_size if it was set to AUTO*/
   inline void set_auto_chunk_size() {
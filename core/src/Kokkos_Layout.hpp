@@ -217,6 +217,15 @@ enum class Iterate {
   Right  // Right indices stride fastest
 };
 
+namespace Experimental {
+// Order in which the host backends hand out the tiles of an MDRangePolicy
+enum class TileOrder {
+  Default,  // Tiles in the order of the outer iteration direction
+  Morton,   // Tiles along a Z-order curve
+  Hilbert   // Tiles along a Hilbert curve
+};
+}  // namespace Experimental
+
 // To check for LayoutTiled
 // This is to hide extra compile-time 'identifier' info within the LayoutTiled
 // class by not relying on template specialization to include the ArgN*'s
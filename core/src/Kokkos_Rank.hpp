@@ -43,6 +43,25 @@ struct Rank {
   static constexpr Iterate inner_direction = InnerDir;
 };
 
+namespace Experimental {
+
+// Compile-time tile extents of an MDRangePolicy. The host backends run the
+// full tiles with loops specialized on these extents.
+template <unsigned... Extents>
+struct StaticTile {
+  static_assert(sizeof...(Extents) > 1u,
+                "Kokkos Error: StaticTile needs at least two extents");
+  static_assert(((Extents != 0u) && ...),
+                "Kokkos Error: StaticTile extents must not be zero");
+
+  using static_tile = StaticTile<Extents...>;
+
+  static constexpr int rank                             = sizeof...(Extents);
+  static constexpr unsigned extents[sizeof...(Extents)] = {Extents...};
+};
+
+}  // namespace Experimental
+
 }  // end namespace Kokkos
 
 #endif  // KOKKOS_KOKKOS_RANK_HPP
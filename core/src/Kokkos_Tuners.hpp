@@ -524,6 +524,96 @@ class TeamSizeTuner : public ExtendableTunerMixin<TeamSizeTuner> {
   TunerType get_tuner() const { return tuner; }
 };
 
+class RangePolicyTuner : public ExtendableTunerMixin<RangePolicyTuner> {
+ private:
+  // chunk sizes per schedule, 0 for static and 1 for dynamic
+  using SpaceDescription = std::map<int64_t, std::vector<int64_t>>;
+  using TunerType = decltype(make_multidimensional_sparse_tuning_problem<20>(
+      std::declval<SpaceDescription>(),
+      std::declval<std::vector<std::string>>()));
+  TunerType tuner;
+
+ public:
+  /**
+   * The chunk sizes worth trying depend on the length of the range, so
+   * launches of a kernel are tuned separately for every power of two
+   * bucket of lengths, the number of bits of the length.
+   */
+  template <typename... Properties>
+  static int length_bucket(const Kokkos::RangePolicy<Properties...>& policy) {
+    int bucket = 0;
+    for (auto length = policy.end() - policy.begin(); length > 0;
+         length /= 2) {
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  RangePolicyTuner() = default;
+  template <typename ViableConfigurationCalculator, typename Functor,
+            typename TagType, typename... Properties>
+  RangePolicyTuner(const std::string& name,
+                   Kokkos::RangePolicy<Properties...>& policy,
+                   const Functor& /*functor*/, const TagType& /*tag*/,
+                   ViableConfigurationCalculator /*calc*/) {
+    /**
+     * A static schedule hands every thread one contiguous block, so it
+     * only keeps the chunk size Kokkos chose. A dynamic schedule is tried
+     * with the chunk sizes that are powers of two, up to the one that gives
+     * every thread a single chunk of the longest range of the length
+     * bucket. A schedule or chunk size the user gave is kept.
+     */
+    std::vector<int64_t> dynamic_chunk_sizes;
+    int const bucket         = length_bucket(policy);
+    std::string const prefix = name + "_length_bits_" + std::to_string(bucket);
+    if (policy.impl_auto_chunk_size()) {
+      int64_t const length = static_cast<int64_t>((uint64_t(1) << bucket) - 1);
+      int64_t const concurrency =
+          std::max(1, static_cast<int>(policy.space().concurrency()));
+      int64_t const per_thread =
+          length / concurrency + (length % concurrency != 0);
+      for (int64_t chunk_size = 1;
+           dynamic_chunk_sizes.size() < 20 &&
+           (chunk_size == 1 || chunk_size <= per_thread);
+           chunk_size *= 2) {
+        dynamic_chunk_sizes.push_back(chunk_size);
+      }
+    } else {
+      dynamic_chunk_sizes.push_back(policy.chunk_size());
+    }
+
+    SpaceDescription space_description;
+    if (policy.impl_auto_schedule() || !policy.impl_dynamic_schedule()) {
+      space_description[0] = {static_cast<int64_t>(policy.chunk_size())};
+    }
+    if (policy.impl_auto_schedule() || policy.impl_dynamic_schedule()) {
+      space_description[1] = dynamic_chunk_sizes;
+    }
+    tuner = make_multidimensional_sparse_tuning_problem<20>(
+        space_description, {prefix + "_schedule", prefix + "_chunk_size"});
+  }
+
+  template <typename... Properties>
+  void tune(Kokkos::RangePolicy<Properties...>& policy) {
+    if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+      auto configuration = tuner.begin();
+      auto schedule      = std::get<0>(configuration);
+      auto chunk_size    = std::get<1>(configuration);
+      if (chunk_size > 0) {
+        policy.impl_set_dynamic_schedule(schedule == 1);
+        policy.impl_set_chunk_size(chunk_size);
+      }
+    }
+  }
+  void end() {
+    if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+      tuner.end();
+    }
+  }
+
+  TunerType get_tuner() const { return tuner; }
+};
+
 namespace Impl {
 
 template <typename T>
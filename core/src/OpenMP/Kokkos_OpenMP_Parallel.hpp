@@ -22,6 +22,8 @@
 
 #include <omp.h>
 #include <OpenMP/Kokkos_OpenMP_Instance.hpp>
+#include <Kokkos_Timer.hpp>
+#include <impl/Kokkos_HostChunkScope.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -82,52 +84,100 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
     functor(WorkTag{}, iwork);
   }
 
-  template <class Policy>
-  std::enable_if_t<std::is_same<typename Policy::schedule_type::type,
-                                Kokkos::Dynamic>::value>
-  execute_parallel() const {
+  // The schedule is a trait of the policy or, for policies without one, may
+  // be chosen at run time by tuning, so both loops exist for every policy.
+  // Every thread flushes its buffers once its share of the loop is done.
+  void execute_parallel_dynamic() const {
     // prevent bug in NVHPC 21.9/CUDA 11.4 (entering zero iterations loop)
     if (m_policy.begin() >= m_policy.end()) return;
-#pragma omp parallel for schedule(dynamic KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) \
-    num_threads(m_instance->thread_pool_size())
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
-      exec_work(m_functor, iwork);
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      HostChunkScope chunk;
+#pragma omp for schedule(dynamic KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) nowait
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
+        exec_work(m_functor, iwork);
+      }
     }
   }
 
-  template <class Policy>
-  std::enable_if_t<!std::is_same<typename Policy::schedule_type::type,
-                                 Kokkos::Dynamic>::value>
-  execute_parallel() const {
+  void execute_parallel_static() const {
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      HostChunkScope chunk;
 // Specifying an chunksize with GCC compiler leads to performance regression
 // with static schedule.
 #ifdef KOKKOS_COMPILER_GNU
-#pragma omp parallel for schedule(static) \
-    num_threads(m_instance->thread_pool_size())
+#pragma omp for schedule(static) nowait
 #else
-#pragma omp parallel for schedule(static KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) \
-    num_threads(m_instance->thread_pool_size())
+#pragma omp for schedule(static KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) nowait
 #endif
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
-      exec_work(m_functor, iwork);
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
+        exec_work(m_functor, iwork);
+      }
+    }
+  }
+
+#ifndef KOKKOS_INTERNAL_DISABLE_NATIVE_OPENMP
+  // Same schedules as execute_parallel_dynamic and execute_parallel_static,
+  // but every thread records how many iterations it executed and how long it
+  // was busy until its share of the loop was done.
+  void execute_parallel_recorded(Kokkos::Tools::Impl::ThreadWork& work) const {
+    if (m_policy.begin() >= m_policy.end()) return;
+    const bool is_dynamic = m_policy.impl_dynamic_schedule();
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      Kokkos::Timer timer;
+      uint64_t count = 0;
+      {
+        HostChunkScope chunk;
+        if (is_dynamic) {
+#pragma omp for schedule(dynamic KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) nowait
+          for (auto iwork = m_policy.begin(); iwork < m_policy.end();
+               ++iwork) {
+            exec_work(m_functor, iwork);
+            ++count;
+          }
+        } else {
+#ifdef KOKKOS_COMPILER_GNU
+#pragma omp for schedule(static) nowait
+#else
+#pragma omp for schedule(static KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) nowait
+#endif
+          for (auto iwork = m_policy.begin(); iwork < m_policy.end();
+               ++iwork) {
+            exec_work(m_functor, iwork);
+            ++count;
+          }
+        }
+      }
+      work.record(omp_get_thread_num(), count, timer.seconds());
     }
   }
+#endif
 
  public:
   inline void execute() const {
     if (execute_in_serial(m_policy.space())) {
+      HostChunkScope chunk;
       exec_range(m_functor, m_policy.begin(), m_policy.end());
       return;
     }
 
+    auto* work = Kokkos::Tools::Impl::begin_thread_work(
+        m_instance->thread_pool_size());
+
 #ifndef KOKKOS_INTERNAL_DISABLE_NATIVE_OPENMP
-    execute_parallel<Policy>();
+    if (work) {
+      execute_parallel_recorded(*work);
+    } else if (m_policy.impl_dynamic_schedule()) {
+      execute_parallel_dynamic();
+    } else {
+      execute_parallel_static();
+    }
 #else
-    constexpr bool is_dynamic =
-        std::is_same<typename Policy::schedule_type::type,
-                     Kokkos::Dynamic>::value;
+    const bool is_dynamic = m_policy.impl_dynamic_schedule();
 #pragma omp parallel num_threads(m_instance->thread_pool_size())
     {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
@@ -140,18 +190,35 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
         if (data.pool_rendezvous()) data.pool_rendezvous_release();
       }
 
-      std::pair<int64_t, int64_t> range(0, 0);
+      // Returns the number of iterations executed by this thread, which is
+      // discarded unless a tool asked for it.
+      auto exec_chunks = [&]() {
+        HostChunkScope chunk;
+        uint64_t count = 0;
+        std::pair<int64_t, int64_t> range(0, 0);
 
-      do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
-                           : data.get_work_partition();
+        do {
+          range = is_dynamic ? data.get_work_stealing_chunk()
+                             : data.get_work_partition();
 
-        exec_range(m_functor, range.first + m_policy.begin(),
-                   range.second + m_policy.begin());
+          exec_range(m_functor, range.first + m_policy.begin(),
+                     range.second + m_policy.begin());
+          if (range.first < range.second) count += range.second - range.first;
 
-      } while (is_dynamic && 0 <= range.first);
+        } while (is_dynamic && 0 <= range.first);
+        return count;
+      };
+
+      if (work) {
+        Kokkos::Timer timer;
+        uint64_t const count = exec_chunks();
+        work->record(data.pool_rank(), count, timer.seconds());
+      } else {
+        exec_chunks();
+      }
     }
 #endif
+    if (work) Kokkos::Tools::Impl::end_thread_work(*work);
   }
 
   inline ParallelFor(const FunctorType& arg_functor, Policy arg_policy)
@@ -339,10 +406,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
       }
       return;
     }
-    enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
-                                Kokkos::Dynamic>::value
-    };
+    const bool is_dynamic = m_policy.impl_dynamic_schedule();
 
     const size_t pool_reduce_bytes = reducer.value_size();
 
@@ -372,6 +436,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
       return;
     }
     const int pool_size = m_instance->thread_pool_size();
+    auto* work          = Kokkos::Tools::Impl::begin_thread_work(pool_size);
 #pragma omp parallel num_threads(pool_size)
     {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
@@ -387,18 +452,34 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
       reference_type update = reducer.init(
           reinterpret_cast<pointer_type>(data.pool_reduce_local()));
 
-      std::pair<int64_t, int64_t> range(0, 0);
+      // Returns the number of iterations executed by this thread, which is
+      // discarded unless a tool asked for it.
+      auto exec_chunks = [&]() {
+        uint64_t count = 0;
+        std::pair<int64_t, int64_t> range(0, 0);
 
-      do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
-                           : data.get_work_partition();
+        do {
+          range = is_dynamic ? data.get_work_stealing_chunk()
+                             : data.get_work_partition();
 
-        ParallelReduce::template exec_range<WorkTag>(
-            m_functor_reducer.get_functor(), range.first + m_policy.begin(),
-            range.second + m_policy.begin(), update);
+          ParallelReduce::template exec_range<WorkTag>(
+              m_functor_reducer.get_functor(), range.first + m_policy.begin(),
+              range.second + m_policy.begin(), update);
+          if (range.first < range.second) count += range.second - range.first;
 
-      } while (is_dynamic && 0 <= range.first);
+        } while (is_dynamic && 0 <= range.first);
+        return count;
+      };
+
+      if (work) {
+        Kokkos::Timer timer;
+        uint64_t const count = exec_chunks();
+        work->record(data.pool_rank(), count, timer.seconds());
+      } else {
+        exec_chunks();
+      }
     }
+    if (work) Kokkos::Tools::Impl::end_thread_work(*work);
 
     // Reduction:
 
@@ -18,6 +18,8 @@
 #define KOKKO_SERIAL_PARALLEL_RANGE_HPP
 
 #include <Kokkos_Parallel.hpp>
+#include <Kokkos_Timer.hpp>
+#include <impl/Kokkos_HostChunkScope.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -49,7 +51,15 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::Serial> {
 
  public:
   inline void execute() const {
-    this->template exec<typename Policy::work_tag>();
+    HostChunkScope chunk;
+    if (auto* work = Kokkos::Tools::Impl::begin_thread_work(1)) {
+      Kokkos::Timer timer;
+      this->template exec<typename Policy::work_tag>();
+      work->record(0, m_policy.end() - m_policy.begin(), timer.seconds());
+      Kokkos::Tools::Impl::end_thread_work(*work);
+    } else {
+      this->template exec<typename Policy::work_tag>();
+    }
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
@@ -118,7 +128,14 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
 
     reference_type update = m_functor_reducer.get_reducer().init(ptr);
 
-    this->template exec<WorkTag>(update);
+    if (auto* work = Kokkos::Tools::Impl::begin_thread_work(1)) {
+      Kokkos::Timer timer;
+      this->template exec<WorkTag>(update);
+      work->record(0, m_policy.end() - m_policy.begin(), timer.seconds());
+      Kokkos::Tools::Impl::end_thread_work(*work);
+    } else {
+      this->template exec<WorkTag>(update);
+    }
 
     m_functor_reducer.get_reducer().final(ptr);
   }
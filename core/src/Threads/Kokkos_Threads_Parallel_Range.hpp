@@ -18,6 +18,8 @@
 #define KOKKOS_THREADS_PARALLEL_RANGE_HPP
 
 #include <Kokkos_Parallel.hpp>
+#include <Kokkos_Timer.hpp>
+#include <impl/Kokkos_HostChunkScope.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -33,6 +35,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
   const FunctorType m_functor;
   const Policy m_policy;
+  mutable Kokkos::Tools::Impl::ThreadWork *m_thread_work = nullptr;
 
   template <class TagType>
   inline static std::enable_if_t<std::is_void<TagType>::value> exec_range(
@@ -59,8 +62,15 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
     }
   }
 
+  // The schedule is a trait of the policy or, for policies without one, may
+  // be chosen at run time by tuning.
   static void exec(ThreadsExec &exec, const void *arg) {
-    exec_schedule<typename Policy::schedule_type::type>(exec, arg);
+    const ParallelFor &self = *((const ParallelFor *)arg);
+    if (self.m_policy.impl_dynamic_schedule()) {
+      exec_schedule<Kokkos::Dynamic>(exec, arg);
+    } else {
+      exec_schedule<Kokkos::Static>(exec, arg);
+    }
   }
 
   template <class Schedule>
@@ -70,9 +80,20 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
     WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
 
-    ParallelFor::template exec_range<WorkTag>(self.m_functor, range.begin(),
-                                              range.end());
-
+    if (self.m_thread_work) {
+      Kokkos::Timer timer;
+      {
+        HostChunkScope chunk;
+        ParallelFor::template exec_range<WorkTag>(self.m_functor,
+                                                  range.begin(), range.end());
+      }
+      self.m_thread_work->record(exec.pool_rank(), range.end() - range.begin(),
+                                 timer.seconds());
+    } else {
+      HostChunkScope chunk;
+      ParallelFor::template exec_range<WorkTag>(self.m_functor, range.begin(),
+                                                range.end());
+    }
     exec.fan_in();
   }
 
@@ -89,27 +110,45 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
     exec.reset_steal_target();
     exec.barrier();
 
-    long work_index = exec.get_work_index();
-
-    while (work_index != -1) {
-      const Member begin =
-          static_cast<Member>(work_index) * self.m_policy.chunk_size() +
-          self.m_policy.begin();
-      const Member end =
-          begin + self.m_policy.chunk_size() < self.m_policy.end()
-              ? begin + self.m_policy.chunk_size()
-              : self.m_policy.end();
-      ParallelFor::template exec_range<WorkTag>(self.m_functor, begin, end);
-      work_index = exec.get_work_index();
-    }
+    // Returns the number of iterations executed by this thread, which is
+    // discarded unless a tool asked for it.
+    auto exec_chunks = [&]() {
+      HostChunkScope chunk;
+      uint64_t count  = 0;
+      long work_index = exec.get_work_index();
+
+      while (work_index != -1) {
+        const Member begin =
+            static_cast<Member>(work_index) * self.m_policy.chunk_size() +
+            self.m_policy.begin();
+        const Member end =
+            begin + self.m_policy.chunk_size() < self.m_policy.end()
+                ? begin + self.m_policy.chunk_size()
+                : self.m_policy.end();
+        ParallelFor::template exec_range<WorkTag>(self.m_functor, begin, end);
+        count += end - begin;
+        work_index = exec.get_work_index();
+      }
+      return count;
+    };
 
+    if (self.m_thread_work) {
+      Kokkos::Timer timer;
+      uint64_t const count = exec_chunks();
+      self.m_thread_work->record(exec.pool_rank(), count, timer.seconds());
+    } else {
+      exec_chunks();
+    }
     exec.fan_in();
   }
 
  public:
   inline void execute() const {
+    m_thread_work = Kokkos::Tools::Impl::begin_thread_work(
+        Kokkos::Threads::impl_thread_pool_size());
     ThreadsExec::start(&ParallelFor::exec, this);
     ThreadsExec::fence();
+    if (m_thread_work) Kokkos::Tools::Impl::end_thread_work(*m_thread_work);
   }
 
   ParallelFor(const FunctorType &arg_functor, const Policy &arg_policy)
@@ -134,6 +173,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
   const CombinedFunctorReducerType m_functor_reducer;
   const Policy m_policy;
   const pointer_type m_result_ptr;
+  mutable Kokkos::Tools::Impl::ThreadWork *m_thread_work = nullptr;
 
   template <class TagType>
   inline static std::enable_if_t<std::is_void<TagType>::value> exec_range(
@@ -163,7 +203,12 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
   }
 
   static void exec(ThreadsExec &exec, const void *arg) {
-    exec_schedule<typename Policy::schedule_type::type>(exec, arg);
+    const ParallelReduce &self = *((const ParallelReduce *)arg);
+    if (self.m_policy.impl_dynamic_schedule()) {
+      exec_schedule<Kokkos::Dynamic>(exec, arg);
+    } else {
+      exec_schedule<Kokkos::Static>(exec, arg);
+    }
   }
 
   template <class Schedule>
@@ -174,10 +219,20 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
 
     const ReducerType &reducer = self.m_functor_reducer.get_reducer();
 
-    ParallelReduce::template exec_range<WorkTag>(
-        self.m_functor_reducer.get_functor(), range.begin(), range.end(),
-        reducer.init(static_cast<pointer_type>(exec.reduce_memory())));
-
+    auto exec_thread_range = [&]() {
+      ParallelReduce::template exec_range<WorkTag>(
+          self.m_functor_reducer.get_functor(), range.begin(), range.end(),
+          reducer.init(static_cast<pointer_type>(exec.reduce_memory())));
+    };
+
+    if (self.m_thread_work) {
+      Kokkos::Timer timer;
+      exec_thread_range();
+      self.m_thread_work->record(exec.pool_rank(), range.end() - range.begin(),
+                                 timer.seconds());
+    } else {
+      exec_thread_range();
+    }
     exec.fan_in_reduce(reducer);
   }
 
@@ -193,24 +248,40 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     exec.reset_steal_target();
     exec.barrier();
 
-    long work_index            = exec.get_work_index();
     const ReducerType &reducer = self.m_functor_reducer.get_reducer();
 
     reference_type update =
         reducer.init(static_cast<pointer_type>(exec.reduce_memory()));
-    while (work_index != -1) {
-      const Member begin =
-          static_cast<Member>(work_index) * self.m_policy.chunk_size() +
-          self.m_policy.begin();
-      const Member end =
-          begin + self.m_policy.chunk_size() < self.m_policy.end()
-              ? begin + self.m_policy.chunk_size()
-              : self.m_policy.end();
-      ParallelReduce::template exec_range<WorkTag>(
-          self.m_functor_reducer.get_functor(), begin, end, update);
-      work_index = exec.get_work_index();
-    }
 
+    // Returns the number of iterations executed by this thread, which is
+    // discarded unless a tool asked for it.
+    auto exec_chunks = [&]() {
+      uint64_t count  = 0;
+      long work_index = exec.get_work_index();
+
+      while (work_index != -1) {
+        const Member begin =
+            static_cast<Member>(work_index) * self.m_policy.chunk_size() +
+            self.m_policy.begin();
+        const Member end =
+            begin + self.m_policy.chunk_size() < self.m_policy.end()
+                ? begin + self.m_policy.chunk_size()
+                : self.m_policy.end();
+        ParallelReduce::template exec_range<WorkTag>(
+            self.m_functor_reducer.get_functor(), begin, end, update);
+        count += end - begin;
+        work_index = exec.get_work_index();
+      }
+      return count;
+    };
+
+    if (self.m_thread_work) {
+      Kokkos::Timer timer;
+      uint64_t const count = exec_chunks();
+      self.m_thread_work->record(exec.pool_rank(), count, timer.seconds());
+    } else {
+      exec_chunks();
+    }
     exec.fan_in_reduce(reducer);
   }
 
@@ -226,10 +297,17 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     } else {
       ThreadsExec::resize_scratch(reducer.value_size(), 0);
 
+      m_thread_work = Kokkos::Tools::Impl::begin_thread_work(
+          Kokkos::Threads::impl_thread_pool_size());
+
       ThreadsExec::start(&ParallelReduce::exec, this);
 
       ThreadsExec::fence();
 
+      if (m_thread_work) {
+        Kokkos::Tools::Impl::end_thread_work(*m_thread_work);
+      }
+
       if (m_result_ptr) {
         const pointer_type data =
             (pointer_type)ThreadsExec::root_reduce_scratch();
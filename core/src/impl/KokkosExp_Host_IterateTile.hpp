@@ -29,6 +29,10 @@
 #define KOKKOS_ENABLE_IVDEP_MDRANGE
 #endif
 
+// Vectorization hint for the innermost loop over a StaticTile in parallel_for,
+// the same opt-in ivdep as the runtime-extent loops
+#define KOKKOS_IMPL_MDRANGE_STATIC_TILE_SIMD KOKKOS_ENABLE_IVDEP_MDRANGE
+
 #include <algorithm>
 
 namespace Kokkos {
@@ -1609,6 +1613,128 @@ struct Tile_Loop_Type<8, IsLeft, IType, Tagged,
 };
 // end Structs for calling loops
 
+// Rotates the Rank low bits of x left by shift
+template <int Rank>
+inline unsigned tile_curve_rotate(unsigned x, int shift) {
+  constexpr unsigned mask = (1u << Rank) - 1;
+  shift %= Rank;
+  return shift == 0 ? x : ((x << shift) | (x >> (Rank - shift))) & mask;
+}
+
+// Computes the coordinates, in tiles, of the tile_idx-th tile along a Morton or
+// Hilbert curve through a grid of tile_end tiles. The curve is laid over the
+// smallest power-of-two cube enclosing the grid and descended one level at a
+// time, skipping the tiles outside of the grid, so any extents are supported.
+// Bit b of a child index selects the upper half of dimension b counted from
+// the fastest outer dimension. The Hilbert child order and orientation follow
+// C. Hamilton, "Compact Hilbert Indices", Dalhousie University CS-2006-07.
+template <int Rank, bool IsLeft, typename IType, typename Point>
+inline void tile_curve_coordinates(Kokkos::Experimental::TileOrder order,
+                                   IType tile_idx, Point const& tile_end,
+                                   Point& tile) {
+  using index_type = typename Point::value_type;
+
+  int levels = 0;
+  for (int i = 0; i < Rank; ++i) {
+    while ((index_type(1) << levels) < tile_end[i]) ++levels;
+    tile[i] = 0;
+  }
+
+  const bool hilbert = order == Kokkos::Experimental::TileOrder::Hilbert;
+  index_type index   = static_cast<index_type>(tile_idx);
+  unsigned entry     = 0;
+  int direction      = 0;
+  for (int level = levels - 1; level >= 0; --level) {
+    const index_type size = index_type(1) << level;
+    for (unsigned w = 0; w < (1u << Rank); ++w) {
+      const unsigned child =
+          hilbert ? tile_curve_rotate<Rank>(w ^ (w >> 1), direction + 1) ^ entry
+                  : w;
+      index_type count = 1;
+      for (int b = 0; b < Rank; ++b) {
+        const int i            = IsLeft ? b : Rank - 1 - b;
+        const index_type lower = tile[i] + ((child >> b) & 1) * size;
+        count *= std::max<index_type>(
+            std::min<index_type>(lower + size, tile_end[i]) - lower, 0);
+      }
+      if (index >= count) {
+        index -= count;
+        continue;
+      }
+      for (int b = 0; b < Rank; ++b) {
+        tile[IsLeft ? b : Rank - 1 - b] += ((child >> b) & 1) * size;
+      }
+      if (hilbert) {
+        // entry corner and direction of the child w
+        const unsigned even = w == 0 ? 0 : (w - 1) & ~1u;
+        unsigned ones       = w == 0 ? 0 : (w & 1) ? w : w - 1;
+        int d               = 0;
+        for (; ones & 1; ones >>= 1) ++d;
+        const unsigned e = even ^ (even >> 1);
+        entry ^= tile_curve_rotate<Rank>(e, direction + 1);
+        direction = (direction + d % Rank + 1) % Rank;
+      }
+      break;
+    }
+  }
+}
+
+// Loops over a full tile of compile-time StaticTile extents. Every loop has a
+// constant trip count the compiler can unroll. When Vectorize is set, the
+// innermost one, over the unit-stride dimension, carries the ivdep hint of
+// KOKKOS_ENABLE_IVDEP_MDRANGE, which is only emitted if aggressive
+// vectorization is enabled.
+// The body is called with the indices of all dimensions.
+template <typename StaticTile, bool IsLeft, typename IType>
+struct Static_Tile_Loop {
+  static constexpr int rank      = StaticTile::rank;
+  static constexpr int outermost = IsLeft ? rank - 1 : 0;
+  static constexpr int innermost = IsLeft ? 0 : rank - 1;
+
+  template <bool Vectorize, typename Offset, typename Body>
+  static void apply(Offset const& offset, Body const& body) {
+    nest<Vectorize, outermost>(offset, body);
+  }
+
+ private:
+  // Loops over dimension D, the indices of the enclosing loops are passed in
+  // order of their dimension
+  template <bool Vectorize, int D, typename Offset, typename Body,
+            typename... Indices>
+  static void nest(Offset const& offset, Body const& body,
+                   Indices... indices) {
+    constexpr IType extent = StaticTile::extents[D];
+    const IType begin      = static_cast<IType>(offset[D]);
+    const IType end        = begin + extent;
+    if constexpr (D != innermost) {
+      for (IType i = begin; i < end; ++i) {
+        if constexpr (IsLeft) {
+          nest<Vectorize, D - 1>(offset, body, i, indices...);
+        } else {
+          nest<Vectorize, D + 1>(offset, body, indices..., i);
+        }
+      }
+    } else if constexpr (Vectorize) {
+      KOKKOS_IMPL_MDRANGE_STATIC_TILE_SIMD
+      for (IType i = begin; i < end; ++i) {
+        if constexpr (IsLeft) {
+          body(i, indices...);
+        } else {
+          body(indices..., i);
+        }
+      }
+    } else {
+      for (IType i = begin; i < end; ++i) {
+        if constexpr (IsLeft) {
+          body(i, indices...);
+        } else {
+          body(indices..., i);
+        }
+      }
+    }
+  }
+};
+
 template <typename RP, typename Functor, typename Tag = void,
           typename ValueType = void, typename Enable = void>
 struct HostIterateTile;
@@ -1659,7 +1785,13 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == Iterate::Left) {
+    if (m_rp.m_tile_order != Kokkos::Experimental::TileOrder::Default) {
+      tile_curve_coordinates<RP::rank, (RP::outer_direction == Iterate::Left)>(
+          m_rp.m_tile_order, tile_idx, m_rp.m_tile_end, m_offset);
+      for (int i = 0; i < RP::rank; ++i) {
+        m_offset[i] = m_offset[i] * m_rp.m_tile[i] + m_rp.m_lower[i];
+      }
+    } else if (RP::outer_direction == Iterate::Left) {
       for (int i = 0; i < RP::rank; ++i) {
         m_offset[i] =
             (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
@@ -1677,6 +1809,21 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
+    if constexpr (!std::is_void<typename RP::static_tile>::value) {
+      if (full_tile) {
+        Static_Tile_Loop<typename RP::static_tile,
+                         (RP::inner_direction == Iterate::Left), index_type>::
+            template apply<true>(m_offset, [&](auto... indices) {
+              if constexpr (std::is_void<Tag>::value) {
+                m_func(indices...);
+              } else {
+                m_func(Tag(), indices...);
+              }
+            });
+        return;
+      }
+    }
+
     Tile_Loop_Type<RP::rank, (RP::inner_direction == Iterate::Left), index_type,
                    Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
                                m_tiledims);
@@ -2074,7 +2221,13 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == Iterate::Left) {
+    if (m_rp.m_tile_order != Kokkos::Experimental::TileOrder::Default) {
+      tile_curve_coordinates<RP::rank, (RP::outer_direction == Iterate::Left)>(
+          m_rp.m_tile_order, tile_idx, m_rp.m_tile_end, m_offset);
+      for (int i = 0; i < RP::rank; ++i) {
+        m_offset[i] = m_offset[i] * m_rp.m_tile[i] + m_rp.m_lower[i];
+      }
+    } else if (RP::outer_direction == Iterate::Left) {
       for (int i = 0; i < RP::rank; ++i) {
         m_offset[i] =
             (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
@@ -2092,6 +2245,21 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
+    if constexpr (!std::is_void<typename RP::static_tile>::value) {
+      if (full_tile) {
+        Static_Tile_Loop<typename RP::static_tile,
+                         (RP::inner_direction == Iterate::Left), index_type>::
+            template apply<false>(m_offset, [&](auto... indices) {
+              if constexpr (std::is_void<Tag>::value) {
+                m_func.get_functor()(indices..., val);
+              } else {
+                m_func.get_functor()(Tag(), indices..., val);
+              }
+            });
+        return;
+      }
+    }
+
     Tile_Loop_Type<RP::rank, (RP::inner_direction == Iterate::Left), index_type,
                    Tag>::apply(val, m_func.get_functor(), full_tile, m_offset,
                                m_rp.m_tile, m_tiledims);
@@ -2487,7 +2655,13 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == Iterate::Left) {
+    if (m_rp.m_tile_order != Kokkos::Experimental::TileOrder::Default) {
+      tile_curve_coordinates<RP::rank, (RP::outer_direction == Iterate::Left)>(
+          m_rp.m_tile_order, tile_idx, m_rp.m_tile_end, m_offset);
+      for (int i = 0; i < RP::rank; ++i) {
+        m_offset[i] = m_offset[i] * m_rp.m_tile[i] + m_rp.m_lower[i];
+      }
+    } else if (RP::outer_direction == Iterate::Left) {
       for (int i = 0; i < RP::rank; ++i) {
         m_offset[i] =
             (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
@@ -2505,6 +2679,21 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
+    if constexpr (!std::is_void<typename RP::static_tile>::value) {
+      if (full_tile) {
+        Static_Tile_Loop<typename RP::static_tile,
+                         (RP::inner_direction == Iterate::Left), index_type>::
+            template apply<false>(m_offset, [&](auto... indices) {
+              if constexpr (std::is_void<Tag>::value) {
+                m_func(indices..., val);
+              } else {
+                m_func(Tag(), indices..., val);
+              }
+            });
+        return;
+      }
+    }
+
     Tile_Loop_Type<RP::rank, (RP::inner_direction == Iterate::Left), index_type,
                    Tag>::apply(val, m_func, full_tile, m_offset, m_rp.m_tile,
                                m_tiledims);
@@ -2848,6 +3037,7 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
 // ------------------------------------------------------------------ //
 
 #undef KOKKOS_ENABLE_NEW_LOOP_MACROS
+#undef KOKKOS_IMPL_MDRANGE_STATIC_TILE_SIMD
 #undef KOKKOS_IMPL_LOOP_1L
 #undef KOKKOS_IMPL_LOOP_2L
 #undef KOKKOS_IMPL_LOOP_3L
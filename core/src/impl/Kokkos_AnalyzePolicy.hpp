@@ -29,6 +29,7 @@
 #include <traits/Kokkos_LaunchBoundsTrait.hpp>
 #include <traits/Kokkos_OccupancyControlTrait.hpp>
 #include <traits/Kokkos_ScheduleTrait.hpp>
+#include <traits/Kokkos_StaticTileTrait.hpp>
 #include <traits/Kokkos_WorkItemPropertyTrait.hpp>
 #include <traits/Kokkos_WorkTagTrait.hpp>
 
@@ -97,6 +97,8 @@ void combine(Kokkos::InitializationSettings& out,
   KOKKOS_IMPL_COMBINE_SETTING(tools_help);
   KOKKOS_IMPL_COMBINE_SETTING(tools_libs);
   KOKKOS_IMPL_COMBINE_SETTING(tools_args);
+  KOKKOS_IMPL_COMBINE_SETTING(tools_builtin);
+  KOKKOS_IMPL_COMBINE_SETTING(tools_sampling);
 #undef KOKKOS_IMPL_COMBINE_SETTING
 }
 
@@ -112,6 +114,12 @@ void combine(Kokkos::InitializationSettings& out,
   if (in.args != InitArguments::unset_string_option) {
     out.set_tools_args(in.args);
   }
+  if (in.builtin != InitArguments::unset_string_option) {
+    out.set_tools_builtin(in.builtin);
+  }
+  if (in.sampling != InitArguments::unset_string_option) {
+    out.set_tools_sampling(in.sampling);
+  }
 }
 
 void combine(Kokkos::Tools::InitArguments& out,
@@ -127,6 +135,12 @@ void combine(Kokkos::Tools::InitArguments& out,
   if (in.has_tools_args()) {
     out.args = in.get_tools_args();
   }
+  if (in.has_tools_builtin()) {
+    out.builtin = in.get_tools_builtin();
+  }
+  if (in.has_tools_sampling()) {
+    out.sampling = in.get_tools_sampling();
+  }
 }
 
 int get_device_count() {
@@ -493,6 +507,9 @@ void pre_initialize_internal(const Kokkos::InitializationSettings& settings) {
     g_show_warnings = false;
   if (settings.has_tune_internals() && settings.get_tune_internals())
     g_tune_internals = true;
+  if (settings.has_tools_sampling())
+    declare_configuration_metadata("tools", "tools_sampling",
+                                   settings.get_tools_sampling());
   declare_configuration_metadata("version_info", "Kokkos Version",
                                  version_string_from_int(KOKKOS_VERSION));
 #ifdef KOKKOS_COMPILER_APPLECC
@@ -885,6 +902,31 @@ Kokkos Tools Options:
                                    kokkos-tool as command-line arguments. E.g.
                                    `<EXE> --kokkos-tools-args="-c input.txt"` will
                                    pass `<EXE> -c input.txt` as argc/argv to tool
+  --kokkos-tools-builtin=STR     : Comma separated list of tools built into Kokkos
+                                   to use instead of a tools library. Available:
+                                   - timer: count and min/avg/max/total time of
+                                            kernels and regions, and GB/s and
+                                            GFLOP/s of kernels declaring work
+                                   - trace: Chrome/Perfetto timeline of kernels,
+                                            fences, deep copies and regions
+                                   - counters: cycles, instructions, IPC and
+                                            cache misses per kernel (Linux)
+                                   - memory: peak and live bytes and allocation
+                                            counts per memory space and label
+                                   - fences: count, blocked time and call
+                                            stacks of global fences
+                                   - tuner: epsilon-greedy autotuner keeping the
+                                            learned choices across runs in
+                                            $KOKKOS_TOOLS_BUILTIN_TUNER_FILE
+                                            (requires Kokkos_ENABLE_TUNING)
+                                   Results are written at finalize to files named
+                                   $KOKKOS_TOOLS_BUILTIN_OUTPUT.<tool>.{txt,json}
+                                   (default prefix kokkos-tools-<pid>)
+  --kokkos-tools-sampling=STR    : Only pass some kernel launches to the tool:
+                                   every:N or percent:P, optionally followed by
+                                   ,first:K to always pass the first K launches of
+                                   each kernel. Tools find the setting in the
+                                   metadata key tools_sampling.
 
 Except for --kokkos[-tools]-help, you can alternatively set the corresponding
 environment variable of a flag (all letters in upper-case and underscores
@@ -0,0 +1,342 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_Half_BulkConversion.hpp>
+#include <Kokkos_BitManipulation.hpp>
+
+#if defined(__F16C__) || defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// Software conversions of a single value between the 16-bit formats and
+// float/double, used for the remainder of the vector loops and on targets
+// without conversion instructions.
+
+std::uint16_t float_to_half_bits(float value) {
+  std::uint32_t const infinity = 255u << 23;
+  std::uint32_t const overflow = (127u + 16u) << 23;
+  float const denorm_magic     = Kokkos::bit_cast<float>(
+      ((127u - 15u) + (23u - 10u) + 1u) << 23);
+  std::uint32_t bits       = Kokkos::bit_cast<std::uint32_t>(value);
+  std::uint32_t const sign = bits & 0x80000000u;
+  bits ^= sign;
+  std::uint32_t result;
+  if (bits >= overflow) {
+    result = bits > infinity ? 0x7e00u : 0x7c00u;
+  } else if (bits < (113u << 23)) {
+    // the float addition aligns the mantissa and rounds to nearest even
+    result = Kokkos::bit_cast<std::uint32_t>(Kokkos::bit_cast<float>(bits) +
+                                             denorm_magic) -
+             Kokkos::bit_cast<std::uint32_t>(denorm_magic);
+  } else {
+    std::uint32_t const mantissa_odd = (bits >> 13) & 1u;
+    // rebias the exponent and round to nearest even
+    bits += 0xc8000fffu + mantissa_odd;
+    result = bits >> 13;
+  }
+  return std::uint16_t(result | (sign >> 16));
+}
+
+std::uint16_t float_to_bhalf_bits(float value) {
+  std::uint32_t const bits = Kokkos::bit_cast<std::uint32_t>(value);
+  // NaN stays NaN (and becomes quiet) instead of rounding up to Inf
+  std::uint32_t const rounded = (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16;
+  std::uint32_t const quiet   = (bits >> 16) | 0x40u;
+  return std::uint16_t((bits & 0x7fffffffu) > 0x7f800000u ? quiet : rounded);
+}
+
+float half_bits_to_float(std::uint16_t h) {
+  std::uint32_t const sign     = std::uint32_t(h & 0x8000u) << 16;
+  std::uint32_t const bits     = std::uint32_t(h & 0x7fffu) << 13;
+  std::uint32_t const exponent = bits & 0x0f800000u;
+  // rebias the exponent from 15 to 127, Inf/NaN need to be moved up to 255
+  std::uint32_t const normal =
+      bits + (112u << 23) + (exponent == 0x0f800000u ? 112u << 23 : 0u);
+  // subnormal halfs are normal floats, renormalize through a subtraction
+  float const magic     = Kokkos::bit_cast<float>(113u << 23);
+  float const subnormal = Kokkos::bit_cast<float>(bits + (113u << 23)) - magic;
+  std::uint32_t const magnitude =
+      exponent == 0 ? Kokkos::bit_cast<std::uint32_t>(subnormal) : normal;
+  return Kokkos::bit_cast<float>(magnitude | sign);
+}
+
+float bhalf_bits_to_float(std::uint16_t h) {
+  return Kokkos::bit_cast<float>(std::uint32_t(h) << 16);
+}
+
+// Rounds a double to nearest even in a 16-bit format with the given number of
+// exponent and mantissa bits, directly instead of through float which would
+// round twice
+template <int ExponentBits, int MantissaBits>
+std::uint16_t double_to_16bit_float(double value) {
+  constexpr int bias               = (1 << (ExponentBits - 1)) - 1;
+  constexpr int dropped            = 52 - MantissaBits;
+  constexpr std::uint32_t infinity = ((1u << ExponentBits) - 1) << MantissaBits;
+
+  std::uint64_t const bits      = Kokkos::bit_cast<std::uint64_t>(value);
+  std::uint32_t const sign      = std::uint32_t(bits >> 48) & 0x8000u;
+  std::uint64_t const magnitude = bits & 0x7fffffffffffffffull;
+  if (magnitude > 0x7ff0000000000000ull) {
+    return std::uint16_t(sign | infinity | (1u << (MantissaBits - 1)));
+  }
+  int const exponent = int(magnitude >> 52) - 1023;
+  if (exponent > bias) return std::uint16_t(sign | infinity);
+
+  std::uint64_t significand = magnitude & 0x000fffffffffffffull;
+  std::uint64_t result      = 0;
+  int shift                 = dropped;
+  if (exponent >= 1 - bias) {
+    result = std::uint64_t(exponent + bias) << MantissaBits;
+  } else {
+    // subnormal, the implicit bit is shifted into the mantissa
+    significand |= 1ull << 52;
+    shift += 1 - bias - exponent;
+    if (shift > 53) return std::uint16_t(sign);
+  }
+  std::uint64_t const kept    = significand >> shift;
+  std::uint64_t const rest    = significand & ((1ull << shift) - 1);
+  std::uint64_t const halfway = 1ull << (shift - 1);
+  // a carry out of the mantissa correctly moves to the next exponent, or to
+  // infinity
+  result += kept + (rest > halfway || (rest == halfway && (kept & 1u)));
+  return std::uint16_t(sign | result);
+}
+
+std::uint16_t double_to_half_bits(double value) {
+  return double_to_16bit_float<5, 10>(value);
+}
+
+std::uint16_t double_to_bhalf_bits(double value) {
+  return double_to_16bit_float<8, 7>(value);
+}
+
+#if defined(__AVX512F__)
+// The unmasked AVX512 conversions pass an undefined vector as the source of
+// the masked out lanes, which GCC reports as maybe uninitialized. The zero
+// masked forms with all lanes selected compute the same values.
+constexpr __mmask16 all_lanes_16 = 0xffff;
+constexpr __mmask8 all_lanes_8   = 0xff;
+#endif
+
+#if defined(__F16C__) || defined(__AVX2__)
+// narrows 4 doubles to float rounding to odd: an inexact result is truncated
+// and its last bit set. rounding that float to nearest even in a 16-bit
+// format, which keeps far fewer bits, gives the same result as rounding the
+// double directly.
+__m128 avx_double_to_float_odd(__m256d const& value) {
+  __m128 const nearest  = _mm256_cvtpd_ps(value);
+  __m256d const back    = _mm256_cvtps_pd(nearest);
+  __m256d const sign    = _mm256_set1_pd(-0.0);
+  __m256d const away    = _mm256_cmp_pd(_mm256_andnot_pd(sign, back),
+                                        _mm256_andnot_pd(sign, value),
+                                        _CMP_GT_OQ);
+  __m256d const inexact = _mm256_cmp_pd(back, value, _CMP_NEQ_UQ);
+  // the masks of the double lanes, narrowed to the float lanes
+  auto const narrow = [](__m256d const& mask) {
+    return _mm_castps_si128(_mm_shuffle_ps(
+        _mm256_castps256_ps128(_mm256_castpd_ps(mask)),
+        _mm256_extractf128_ps(_mm256_castpd_ps(mask), 1),
+        _MM_SHUFFLE(2, 0, 2, 0)));
+  };
+  // a value rounded away from zero moves back by one unit in the last place,
+  // which is all ones in the mask
+  __m128i const truncated =
+      _mm_add_epi32(_mm_castps_si128(nearest), narrow(away));
+  return _mm_castsi128_ps(_mm_or_si128(
+      truncated, _mm_and_si128(narrow(inexact), _mm_set1_epi32(1))));
+}
+#endif
+
+#if defined(__AVX2__)
+// rounds 8 floats to bfloat16 with the same semantics as float_to_bhalf_bits
+__m128i avx2_float_to_bhalf(__m256 const& value) {
+  __m256i const bits  = _mm256_castps_si256(value);
+  __m256i const upper = _mm256_srli_epi32(bits, 16);
+  __m256i const bias  = _mm256_add_epi32(
+      _mm256_and_si256(upper, _mm256_set1_epi32(1)), _mm256_set1_epi32(0x7fff));
+  __m256i const rounded =
+      _mm256_srli_epi32(_mm256_add_epi32(bits, bias), 16);
+  __m256i const quiet = _mm256_or_si256(upper, _mm256_set1_epi32(0x40));
+  __m256i const nan =
+      _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+  __m256i const result = _mm256_blendv_epi8(rounded, quiet, nan);
+  // packus works within 128-bit halves, gather the two low quadwords
+  return _mm256_castsi256_si128(_mm256_permute4x64_epi64(
+      _mm256_packus_epi32(result, result), 0x08));
+}
+#endif
+
+}  // namespace
+
+void Kokkos::Impl::convert_half_to_float(std::uint16_t const* src, float* dst,
+                                         std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    __m256i const half =
+        _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i));
+    _mm512_storeu_ps(dst + i, _mm512_maskz_cvtph_ps(all_lanes_16, half));
+  }
+#elif defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(
+                                  reinterpret_cast<__m128i const*>(src + i))));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = half_bits_to_float(src[i]);
+}
+
+void Kokkos::Impl::convert_float_to_half(float const* src, std::uint16_t* dst,
+                                         std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst + i),
+        _mm512_maskz_cvtps_ph(all_lanes_16, _mm512_loadu_ps(src + i),
+                              _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+#elif defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + i),
+        _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = float_to_half_bits(src[i]);
+}
+
+void Kokkos::Impl::convert_half_to_double(std::uint16_t const* src,
+                                          double* dst, std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__) && defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    __m256 const value = _mm256_cvtph_ps(
+        _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i)));
+    _mm512_storeu_pd(dst + i, _mm512_maskz_cvtps_pd(all_lanes_8, value));
+  }
+#elif defined(__F16C__)
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(dst + i,
+                     _mm256_cvtps_pd(_mm_cvtph_ps(_mm_loadl_epi64(
+                         reinterpret_cast<__m128i const*>(src + i)))));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t const value =
+        vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i)));
+    vst1q_f64(dst + i, vcvt_f64_f32(vget_low_f32(value)));
+    vst1q_f64(dst + i + 2, vcvt_high_f64_f32(value));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = half_bits_to_float(src[i]);
+}
+
+void Kokkos::Impl::convert_double_to_half(double const* src,
+                                          std::uint16_t* dst, std::size_t n) {
+  std::size_t i = 0;
+#if defined(__F16C__)
+  for (; i + 4 <= n; i += 4) {
+    _mm_storel_epi64(
+        reinterpret_cast<__m128i*>(dst + i),
+        _mm_cvtps_ph(avx_double_to_float_odd(_mm256_loadu_pd(src + i)),
+                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    // fcvtxn narrows to float rounding to odd
+    float32x4_t const value = vcvtx_high_f32_f64(
+        vcvtx_f32_f64(vld1q_f64(src + i)), vld1q_f64(src + i + 2));
+    vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(value)));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = double_to_half_bits(src[i]);
+}
+
+void Kokkos::Impl::convert_bhalf_to_float(std::uint16_t const* src,
+                                          float* dst, std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    __m256i const wide = _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i)));
+    _mm256_storeu_ps(dst + i,
+                     _mm256_castsi256_ps(_mm256_slli_epi32(wide, 16)));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = bhalf_bits_to_float(src[i]);
+}
+
+void Kokkos::Impl::convert_float_to_bhalf(float const* src, std::uint16_t* dst,
+                                          std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     avx2_float_to_bhalf(_mm256_loadu_ps(src + i)));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = float_to_bhalf_bits(src[i]);
+}
+
+void Kokkos::Impl::convert_bhalf_to_double(std::uint16_t const* src,
+                                           double* dst, std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 4 <= n; i += 4) {
+    __m128i const wide = _mm_cvtepu16_epi32(
+        _mm_loadl_epi64(reinterpret_cast<__m128i const*>(src + i)));
+    _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_castsi128_ps(
+                                  _mm_slli_epi32(wide, 16))));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = bhalf_bits_to_float(src[i]);
+}
+
+void Kokkos::Impl::convert_double_to_bhalf(double const* src,
+                                           std::uint16_t* dst, std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    __m128 const low  = avx_double_to_float_odd(_mm256_loadu_pd(src + i));
+    __m128 const high = avx_double_to_float_odd(_mm256_loadu_pd(src + i + 4));
+    __m256 const value =
+        _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     avx2_float_to_bhalf(value));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = double_to_bhalf_bits(src[i]);
+}
@@ -0,0 +1,53 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HALF_BULKCONVERSION_HPP
+#define KOKKOS_IMPL_HALF_BULKCONVERSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Kokkos {
+namespace Impl {
+
+// Conversions between arrays of IEEE binary16 or bfloat16 bit patterns and
+// float/double on the host. Narrowing rounds to nearest even, from double
+// directly rather than through float, widening is exact. They use F16C or
+// AVX-512 (binary16), AVX2 (bfloat16) or NEON (binary16) when Kokkos is built
+// for these architectures and a software conversion otherwise.
+
+void convert_half_to_float(std::uint16_t const* src, float* dst,
+                           std::size_t n);
+void convert_float_to_half(float const* src, std::uint16_t* dst,
+                           std::size_t n);
+void convert_half_to_double(std::uint16_t const* src, double* dst,
+                            std::size_t n);
+void convert_double_to_half(double const* src, std::uint16_t* dst,
+                            std::size_t n);
+
+void convert_bhalf_to_float(std::uint16_t const* src, float* dst,
+                            std::size_t n);
+void convert_float_to_bhalf(float const* src, std::uint16_t* dst,
+                            std::size_t n);
+void convert_bhalf_to_double(std::uint16_t const* src, double* dst,
+                             std::size_t n);
+void convert_double_to_bhalf(double const* src, std::uint16_t* dst,
+                             std::size_t n);
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,68 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_CHUNK_SCOPE_HPP
+#define KOKKOS_IMPL_HOST_CHUNK_SCOPE_HPP
+
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+// The iterations a host thread runs for a range parallel_for of the Serial,
+// OpenMP or Threads backend. Per thread buffers, see
+// Kokkos::Experimental::accumulated_atomic_add, register a flush while a
+// scope is open and the scope calls it when it closes, before the thread
+// reports its share of the kernel as done. Nested scopes flush everything
+// registered so far, so that the updates of a nested kernel are visible when
+// it returns.
+class HostChunkScope {
+ public:
+  using flush_type = void (*)();
+
+  HostChunkScope() { ++state().depth; }
+  ~HostChunkScope() {
+    State& s = state();
+    for (flush_type flush : s.flushes) flush();
+    s.flushes.clear();
+    --s.depth;
+  }
+
+  HostChunkScope(HostChunkScope const&) = delete;
+  HostChunkScope& operator=(HostChunkScope const&) = delete;
+
+  // whether the calling thread runs the iterations of such a kernel
+  static bool active() { return state().depth > 0; }
+
+  // calls flush when the innermost open scope of the calling thread closes
+  static void on_close(flush_type flush) { state().flushes.push_back(flush); }
+
+ private:
+  struct State {
+    int depth = 0;
+    std::vector<flush_type> flushes;
+  };
+
+  static State& state() {
+    thread_local State s;
+    return s;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -76,6 +76,8 @@ class InitializationSettings {
   KOKKOS_IMPL_DECLARE(bool, tools_help);
   KOKKOS_IMPL_DECLARE(std::string, tools_libs);
   KOKKOS_IMPL_DECLARE(std::string, tools_args);
+  KOKKOS_IMPL_DECLARE(std::string, tools_builtin);
+  KOKKOS_IMPL_DECLARE(std::string, tools_sampling);
 
 #undef KOKKOS_IMPL_INIT_ARGS_DATA_MEMBER_TYPE
 #undef KOKKOS_IMPL_INIT_ARGS_DATA_MEMBER
@@ -26,6 +26,7 @@
 #include <impl/Kokkos_Profiling.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <impl/Kokkos_Command_Line_Parsing.hpp>
+#include <impl/Kokkos_Tools_Builtin.hpp>
 
 #if defined(KOKKOS_ENABLE_LIBDL) || defined(KOKKOS_TOOLS_INDEPENDENT_BUILD)
 #include <dlfcn.h>
@@ -34,10 +35,16 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <functional>
 #include <memory>
+#include <random>
 #include <stack>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -87,9 +94,11 @@ void parse_command_line_arguments(int& argc, char* argv[],
   using Kokkos::Impl::check_arg;
   using Kokkos::Impl::check_arg_str;
 
-  auto& libs = arguments.lib;
-  auto& args = arguments.args;
-  auto& help = arguments.help;
+  auto& libs     = arguments.lib;
+  auto& args     = arguments.args;
+  auto& help     = arguments.help;
+  auto& builtin  = arguments.builtin;
+  auto& sampling = arguments.sampling;
   while (iarg < argc) {
     bool remove_flag = false;
     if (check_arg_str(argv[iarg], "--kokkos-tools-libs", libs) ||
@@ -118,6 +127,12 @@ void parse_command_line_arguments(int& argc, char* argv[],
       }
       // add the name of the executable to the beginning
       if (argc > 0) args = std::string(argv[0]) + " " + args;
+    } else if (check_arg_str(argv[iarg], "--kokkos-tools-builtin", builtin)) {
+      // builtin tools do not depend on libdl
+      remove_flag = true;
+    } else if (check_arg_str(argv[iarg], "--kokkos-tools-sampling",
+                             sampling)) {
+      remove_flag = true;
     } else if (check_arg(argv[iarg], "--kokkos-tools-help")) {
       help = InitArguments::PossiblyUnsetOption::on;
       warn_cmd_line_arg_ignored_when_kokkos_tools_disabled(argv[iarg]);
@@ -176,12 +191,162 @@ Kokkos::Tools::Impl::InitializationStatus parse_environment_variables(
                                                     env_tools_args);
     args = env_tools_args;
   }
+  auto env_tools_builtin = std::getenv("KOKKOS_TOOLS_BUILTIN");
+  if (env_tools_builtin != nullptr) {
+    arguments.builtin = env_tools_builtin;
+  }
+  auto env_tools_sampling = std::getenv("KOKKOS_TOOLS_SAMPLING");
+  if (env_tools_sampling != nullptr) {
+    arguments.sampling = env_tools_sampling;
+  }
   return {
       Kokkos::Tools::Impl::InitializationStatus::InitializationResult::success,
       ""};
 }
+InternedKernelName intern_kernel_name(std::string_view name) {
+  // the deque never moves its elements, the map keys point into it
+  static std::mutex mutex;
+  static std::deque<std::string> names;
+  static std::unordered_map<std::string_view, uint32_t> ids;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = ids.find(name);
+  if (it == ids.end()) {
+    names.emplace_back(name);
+    it = ids.emplace(names.back(), static_cast<uint32_t>(names.size() - 1))
+             .first;
+  }
+  return {it->second, &names[it->second]};
+}
+
+namespace {
+struct SamplingConfig {
+  bool enabled       = false;
+  uint64_t every     = 1;
+  double probability = 1.;
+  uint64_t first     = 0;
+} sampling_config;
+
+// launches of every kernel on this thread, indexed by the interned kernel id,
+// so that the sampling decision does not synchronize with other threads
+thread_local std::vector<uint64_t> sampling_launch_counts;
+// decisions for the kernels that are running on this thread, innermost in
+// the lowest bit
+thread_local uint64_t sampling_decisions = 0;
+
+bool parse_sampling_value(std::string const& value, double& result) {
+  char* end = nullptr;
+  result    = std::strtod(value.c_str(), &end);
+  return !value.empty() && *end == '\0';
+}
+}  // namespace
+
+InitializationStatus configure_sampling(std::string const& config) {
+  SamplingConfig parsed;
+  bool has_every = false, has_percent = false;
+  std::stringstream ss(config);
+  for (std::string token; std::getline(ss, token, ',');) {
+    auto const colon = token.find(':');
+    std::string const key =
+        colon == std::string::npos ? token : token.substr(0, colon);
+    double value = 0.;
+    bool valid   = colon != std::string::npos &&
+                 parse_sampling_value(token.substr(colon + 1), value);
+    if (valid && key == "every" && value >= 1. && value == uint64_t(value)) {
+      parsed.every = value;
+      has_every    = true;
+    } else if (valid && key == "percent" && value > 0. && value <= 100.) {
+      parsed.probability = value / 100.;
+      has_percent        = true;
+    } else if (valid && key == "first" && value >= 0. &&
+               value == uint64_t(value)) {
+      parsed.first = value;
+    } else {
+      valid = false;
+    }
+    if (!valid) {
+      std::string message = "invalid sampling option '" + token + "' in '" +
+                            config +
+                            "', expected every:N or percent:P, optionally "
+                            "followed by ,first:K";
+      std::cerr << "Error: " << message << ". Raised by Kokkos::initialize()."
+                << std::endl;
+      return {InitializationStatus::InitializationResult::failure, message};
+    }
+  }
+  if (has_every == has_percent) {
+    std::string message = "sampling '" + config +
+                          "' needs exactly one of every:N and percent:P";
+    std::cerr << "Error: " << message << ". Raised by Kokkos::initialize()."
+              << std::endl;
+    return {InitializationStatus::InitializationResult::failure, message};
+  }
+  parsed.enabled  = true;
+  sampling_config = parsed;
+  return {InitializationStatus::InitializationResult::success, ""};
+}
+
+bool sampling_enabled() { return sampling_config.enabled; }
+
+bool begin_kernel_sample(uint32_t kernel_id) {
+  if (!sampling_config.enabled) return true;
+  if (kernel_id >= sampling_launch_counts.size()) {
+    sampling_launch_counts.resize(kernel_id + 1);
+  }
+  uint64_t const launch = sampling_launch_counts[kernel_id]++;
+  bool sampled = true;
+  if (launch >= sampling_config.first) {
+    if (sampling_config.probability >= 1.) {
+      sampled = (launch - sampling_config.first) % sampling_config.every == 0;
+    } else {
+      static thread_local std::minstd_rand engine(
+          std::hash<std::thread::id>()(std::this_thread::get_id()));
+      sampled = std::uniform_real_distribution<double>()(engine) <
+                sampling_config.probability;
+    }
+  }
+  sampling_decisions = (sampling_decisions << 1) | uint64_t(sampled);
+  return sampled;
+}
+
+bool end_kernel_sample() {
+  if (!sampling_config.enabled) return true;
+  bool const sampled = sampling_decisions & 1u;
+  sampling_decisions >>= 1;
+  return sampled;
+}
+
+double sampling_weight(uint64_t n) {
+  if (!sampling_config.enabled || n < sampling_config.first) return 1.;
+  return sampling_config.every > 1 ? double(sampling_config.every)
+                                   : 1. / sampling_config.probability;
+}
+
 InitializationStatus initialize_tools_subsystem(
     const Kokkos::Tools::InitArguments& args) {
+  if (args.sampling != Kokkos::Tools::InitArguments::unset_string_option &&
+      !args.sampling.empty()) {
+    auto status = configure_sampling(args.sampling);
+    if (status.result != InitializationStatus::InitializationResult::success)
+      return status;
+  }
+  if (args.builtin != Kokkos::Tools::InitArguments::unset_string_option &&
+      !args.builtin.empty()) {
+    if (args.lib != Kokkos::Tools::InitArguments::unset_string_option &&
+        !args.lib.empty()) {
+      if (Kokkos::show_warnings()) {
+        std::cerr << "Warning: builtin tools '" << args.builtin
+                  << "' ignored because the tools library '" << args.lib
+                  << "' was requested. Raised by Kokkos::initialize()."
+                  << std::endl;
+      }
+    } else {
+      auto status = initialize_builtin_tools(args.builtin);
+      if (status.result != InitializationStatus::InitializationResult::success)
+        return status;
+      Kokkos::Profiling::initialize("");
+      return status;
+    }
+  }
 #ifdef KOKKOS_TOOLS_ENABLE_LIBDL
   Kokkos::Profiling::initialize(args.lib);
   auto final_args =
@@ -264,6 +429,7 @@ bool eventSetsEqual(const EventSet& l, const EventSet& r) {
          l.end_deep_copy == r.end_deep_copy && l.begin_fence == r.begin_fence &&
          l.end_fence == r.end_fence && l.sync_dual_view == r.sync_dual_view &&
          l.modify_dual_view == r.modify_dual_view &&
+         l.thread_work == r.thread_work && l.kernel_work == r.kernel_work &&
          l.declare_metadata == r.declare_metadata &&
          l.request_tool_settings == r.request_tool_settings &&
          l.provide_tool_programming_interface ==
@@ -288,8 +454,10 @@ inline void invoke_kokkosp_callback(
     if (may_require_global_fencing == MayRequireGlobalFencing::Yes &&
         (tool_requirements.requires_global_fencing)) {
 #ifndef KOKKOS_TOOLS_INDEPENDENT_BUILD
-      Kokkos::fence(
-          "Kokkos::Tools::invoke_kokkosp_callback: Kokkos Profile Tool Fence");
+      // a static name avoids allocating a string for every kernel launch
+      static const std::string fence_name =
+          "Kokkos::Tools::invoke_kokkosp_callback: Kokkos Profile Tool Fence";
+      Kokkos::fence(fence_name);
 #endif
     }
     (*callback)(std::forward<Args>(args)...);
@@ -589,6 +757,42 @@ void lookup_function(void* dlopen_handle, const std::string& basename,
 #endif
 }
 
+// Declares the kokkos.kernel_name and kokkos.kernel_type inputs that the
+// tuning contexts of kernel launches refer to.
+static void declare_kernel_context_variables() {
+#ifdef KOKKOS_ENABLE_TUNING
+  Experimental::VariableInfo kernel_name;
+  kernel_name.type = Experimental::ValueType::kokkos_value_string;
+  kernel_name.category =
+      Experimental::StatisticalCategory::kokkos_value_categorical;
+  kernel_name.valueQuantity =
+      Experimental::CandidateValueType::kokkos_value_unbounded;
+
+  std::array<std::string, 4> candidate_values = {
+      "parallel_for",
+      "parallel_reduce",
+      "parallel_scan",
+      "parallel_copy",
+  };
+
+  Experimental::SetOrRange kernel_type_variable_candidates =
+      Experimental::make_candidate_set(4, candidate_values.data());
+
+  Experimental::kernel_name_context_variable_id =
+      Experimental::declare_input_type("kokkos.kernel_name", kernel_name);
+
+  Experimental::VariableInfo kernel_type;
+  kernel_type.type = Experimental::ValueType::kokkos_value_string;
+  kernel_type.category =
+      Experimental::StatisticalCategory::kokkos_value_categorical;
+  kernel_type.valueQuantity =
+      Experimental::CandidateValueType::kokkos_value_set;
+  kernel_type.candidates = kernel_type_variable_candidates;
+  Experimental::kernel_type_context_variable_id =
+      Experimental::declare_input_type("kokkos.kernel_type", kernel_type);
+#endif
+}
+
 void initialize(const std::string& profileLibrary) {
   // Make sure initialize calls happens only once
   static int is_initialized = 0;
@@ -623,6 +827,9 @@ void initialize(const std::string& profileLibrary) {
   if ((profileLibrary.empty()) ||
       (profileLibrary == InitArguments::unset_string_option)) {
     invoke_init_callbacks();
+    // the builtin tools are registered without a library, and their tuner
+    // keys problems by these inputs
+    declare_kernel_context_variables();
     return;
   }
 
@@ -684,6 +891,10 @@ void initialize(const std::string& profileLibrary) {
                       Experimental::current_callbacks.sync_dual_view);
       lookup_function(firstProfileLibrary, "kokkosp_dual_view_modify",
                       Experimental::current_callbacks.modify_dual_view);
+      lookup_function(firstProfileLibrary, "kokkosp_thread_work",
+                      Experimental::current_callbacks.thread_work);
+      lookup_function(firstProfileLibrary, "kokkosp_kernel_work",
+                      Experimental::current_callbacks.kernel_work);
 
       lookup_function(firstProfileLibrary, "kokkosp_declare_metadata",
                       Experimental::current_callbacks.declare_metadata);
@@ -732,38 +943,7 @@ void initialize(const std::string& profileLibrary) {
 
   invoke_init_callbacks();
 
-#ifdef KOKKOS_ENABLE_TUNING
-  Experimental::VariableInfo kernel_name;
-  kernel_name.type = Experimental::ValueType::kokkos_value_string;
-  kernel_name.category =
-      Experimental::StatisticalCategory::kokkos_value_categorical;
-  kernel_name.valueQuantity =
-      Experimental::CandidateValueType::kokkos_value_unbounded;
-
-  std::array<std::string, 4> candidate_values = {
-      "parallel_for",
-      "parallel_reduce",
-      "parallel_scan",
-      "parallel_copy",
-  };
-
-  Experimental::SetOrRange kernel_type_variable_candidates =
-      Experimental::make_candidate_set(4, candidate_values.data());
-
-  Experimental::kernel_name_context_variable_id =
-      Experimental::declare_input_type("kokkos.kernel_name", kernel_name);
-
-  Experimental::VariableInfo kernel_type;
-  kernel_type.type = Experimental::ValueType::kokkos_value_string;
-  kernel_type.category =
-      Experimental::StatisticalCategory::kokkos_value_categorical;
-  kernel_type.valueQuantity =
-      Experimental::CandidateValueType::kokkos_value_set;
-  kernel_type.candidates = kernel_type_variable_candidates;
-  Experimental::kernel_type_context_variable_id =
-      Experimental::declare_input_type("kokkos.kernel_type", kernel_type);
-
-#endif
+  declare_kernel_context_variables();
 
   Experimental::no_profiling.init     = nullptr;
   Experimental::no_profiling.finalize = nullptr;
@@ -845,6 +1025,61 @@ void declareMetadata(const std::string& key, const std::string& value) {
       value.c_str());
 }
 
+namespace Impl {
+
+namespace {
+// one record per kernel running on this thread, as a kernel launched from
+// within another kernel must not overwrite the record of the outer one
+thread_local std::vector<std::unique_ptr<ThreadWork>> thread_work_records;
+thread_local size_t thread_work_depth = 0;
+
+struct DeclaredKernelWork {
+  double bytes;
+  double flops;
+  bool per_iteration;
+};
+// innermost ScopedKernelWork of this thread last
+thread_local std::vector<DeclaredKernelWork> kernel_work_declarations;
+}  // namespace
+
+ThreadWork* begin_thread_work(int num_threads) {
+  if (Experimental::current_callbacks.thread_work == nullptr ||
+      (sampling_config.enabled && !(sampling_decisions & 1u))) {
+    return nullptr;
+  }
+  if (thread_work_depth == thread_work_records.size()) {
+    thread_work_records.push_back(std::make_unique<ThreadWork>());
+  }
+  ThreadWork& work = *thread_work_records[thread_work_depth++];
+  work.iterations.assign(num_threads, 0);
+  work.busy_seconds.assign(num_threads, 0.);
+  return &work;
+}
+
+void end_thread_work(ThreadWork const& work) {
+  --thread_work_depth;
+  Experimental::invoke_kokkosp_callback(
+      Experimental::MayRequireGlobalFencing::No,
+      Experimental::current_callbacks.thread_work,
+      static_cast<uint32_t>(work.iterations.size()), work.iterations.data(),
+      work.busy_seconds.data());
+}
+
+void report_kernel_work(uint64_t kernel_id, uint64_t iterations) {
+  if (Experimental::current_callbacks.kernel_work == nullptr ||
+      kernel_work_declarations.empty()) {
+    return;
+  }
+  auto const& work = kernel_work_declarations.back();
+  double const n   = work.per_iteration ? double(iterations) : 1.;
+  Experimental::invoke_kokkosp_callback(
+      Experimental::MayRequireGlobalFencing::No,
+      Experimental::current_callbacks.kernel_work, kernel_id, n * work.bytes,
+      n * work.flops);
+}
+
+}  // namespace Impl
+
 }  // namespace Tools
 
 namespace Tools {
@@ -927,6 +1162,12 @@ void set_dual_view_sync_callback(dualViewSyncFunction callback) {
 void set_dual_view_modify_callback(dualViewModifyFunction callback) {
   current_callbacks.modify_dual_view = callback;
 }
+void set_thread_work_callback(threadWorkFunction callback) {
+  current_callbacks.thread_work = callback;
+}
+void set_kernel_work_callback(kernelWorkFunction callback) {
+  current_callbacks.kernel_work = callback;
+}
 void set_declare_metadata_callback(declareMetadataFunction callback) {
   current_callbacks.declare_metadata = callback;
 }
@@ -961,6 +1202,15 @@ void set_declare_optimization_goal_callback(
   current_callbacks.declare_optimization_goal = callback;
 }
 
+ScopedKernelWork::ScopedKernelWork(double bytes, double flops,
+                                   KernelWorkUnit unit) {
+  Kokkos::Tools::Impl::kernel_work_declarations.push_back(
+      {bytes, flops, unit == KernelWorkUnit::per_iteration});
+}
+ScopedKernelWork::~ScopedKernelWork() {
+  Kokkos::Tools::Impl::kernel_work_declarations.pop_back();
+}
+
 void pause_tools() {
   backup_callbacks  = current_callbacks;
   current_callbacks = no_profiling;
@@ -23,8 +23,10 @@
 #include <unordered_map>
 #include <map>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <mutex>
+#include <vector>
 namespace Kokkos {
 
 // forward declaration
@@ -42,6 +44,8 @@ struct InitArguments {
   PossiblyUnsetOption help = unset;
   std::string lib          = unset_string_option;
   std::string args         = unset_string_option;
+  std::string builtin      = unset_string_option;
+  std::string sampling     = unset_string_option;
 };
 
 namespace Impl {
@@ -64,6 +68,56 @@ void parse_command_line_arguments(int& narg, char* arg[],
 Kokkos::Tools::Impl::InitializationStatus parse_environment_variables(
     InitArguments& arguments);
 
+// Kernel names are interned on first use. The id and the string of a name
+// never change, so tools receive the same pointer for every launch of a
+// kernel and tuners can look kernels up by id.
+struct InternedKernelName {
+  uint32_t id;
+  std::string const* name;
+};
+InternedKernelName intern_kernel_name(std::string_view name);
+
+// Sampling of kernel launches, configured with --kokkos-tools-sampling as
+// "every:N" or "percent:P", optionally followed by ",first:K". The first K
+// launches of each kernel are always passed to the tool. Later ones are
+// passed every Nth time or with probability P%. Launches are counted per host
+// thread. Other events are not sampled because tools pair them (allocations
+// and deallocations, regions).
+InitializationStatus configure_sampling(std::string const& config);
+bool sampling_enabled();
+// Whether a launch of the kernel is passed to the tool. Each call must be
+// matched by end_kernel_sample() on the same thread, which returns the same
+// decision.
+bool begin_kernel_sample(uint32_t kernel_id);
+bool end_kernel_sample();
+// Number of launches represented by the n-th (0-based) sampled launch of a
+// kernel. Tools multiply counts and times with it to scale statistics.
+double sampling_weight(uint64_t n);
+
+// Iterations and busy time of every thread of a host backend during one
+// kernel launch. The backends only record them if a tool set the thread work
+// callback, as begin_thread_work returns nullptr otherwise.
+struct ThreadWork {
+  std::vector<uint64_t> iterations;
+  std::vector<double> busy_seconds;
+
+  void record(int thread, uint64_t thread_iterations, double seconds) {
+    iterations[thread]   = thread_iterations;
+    busy_seconds[thread] = seconds;
+  }
+};
+// Returns a zeroed record for num_threads threads, owned by the calling
+// thread, or nullptr if no tool asked for it or the kernel is not sampled.
+ThreadWork* begin_thread_work(int num_threads);
+// Passes the record to the tool. Must be called for every record returned by
+// begin_thread_work, on the thread that launched the kernel.
+void end_thread_work(ThreadWork const& work);
+
+// Passes the work declared with ScopedKernelWork, if any, to the tool for a
+// kernel with the given number of iterations. Called after the begin
+// callback of the kernel.
+void report_kernel_work(uint64_t kernel_id, uint64_t iterations);
+
 }  // namespace Impl
 
 bool profileLibraryLoaded();
@@ -236,6 +290,19 @@ void set_end_fence_callback(endFenceFunction callback);
 void set_dual_view_sync_callback(dualViewSyncFunction callback);
 void set_dual_view_modify_callback(dualViewModifyFunction callback);
 void set_declare_metadata_callback(declareMetadataFunction callback);
+/**
+ * The thread work callback receives the number of threads and the
+ * iterations and busy seconds of each thread for RangePolicy kernels on the
+ * host backends. It refers to the innermost kernel running on the calling
+ * thread and is invoked before the end callback of that kernel.
+ */
+void set_thread_work_callback(threadWorkFunction callback);
+/**
+ * The kernel work callback receives the kernel ID and the bytes moved and
+ * floating point operations declared with ScopedKernelWork for the launch.
+ * It is invoked after the begin callback of the kernel.
+ */
+void set_kernel_work_callback(kernelWorkFunction callback);
 void set_request_tool_settings_callback(requestToolSettingsFunction callback);
 void set_provide_tool_programming_interface_callback(
     provideToolProgrammingInterfaceFunction callback);
@@ -250,6 +317,35 @@ void set_begin_context_callback(contextBeginFunction callback);
 void pause_tools();
 void resume_tools();
 
+enum class KernelWorkUnit { per_launch, per_iteration };
+
+/**
+ * Declares the bytes moved and the floating point operations of the kernels
+ * launched on this thread while the object is alive, so that tools can
+ * compute the achieved bandwidth and flop rate. The work is given per launch
+ * or per iteration, i.e. per index of a RangePolicy, per point of an
+ * MDRangePolicy or per team of a TeamPolicy. It applies to every kernel in
+ * the scope, including the ones Kokkos launches internally, so the scope
+ * should only enclose the launch it describes:
+ *
+ *   {
+ *     Kokkos::Tools::Experimental::ScopedKernelWork work(
+ *         3 * sizeof(double), 2,
+ *         Kokkos::Tools::Experimental::KernelWorkUnit::per_iteration);
+ *     Kokkos::parallel_for("triad", n, KOKKOS_LAMBDA(int i) {
+ *       a(i) = b(i) + s * c(i);
+ *     });
+ *   }
+ */
+class ScopedKernelWork {
+ public:
+  ScopedKernelWork(double bytes, double flops,
+                   KernelWorkUnit unit = KernelWorkUnit::per_launch);
+  ~ScopedKernelWork();
+  ScopedKernelWork(ScopedKernelWork const&) = delete;
+  ScopedKernelWork& operator=(ScopedKernelWork const&) = delete;
+};
+
 EventSet get_callbacks();
 void set_callbacks(EventSet new_events);
 }  // namespace Experimental
@@ -105,6 +105,16 @@ typedef void (*Kokkos_Profiling_dualViewModifyFunction)(const char*,
 typedef void (*Kokkos_Profiling_declareMetadataFunction)(const char*,
                                                          const char*);
 
+// NOLINTNEXTLINE(modernize-use-using): C compatibility
+typedef void (*Kokkos_Profiling_threadWorkFunction)(const uint32_t,
+                                                    const uint64_t*,
+                                                    const double*);
+
+// NOLINTNEXTLINE(modernize-use-using): C compatibility
+typedef void (*Kokkos_Profiling_kernelWorkFunction)(const uint64_t,
+                                                    const double,
+                                                    const double);
+
 // NOLINTNEXTLINE(modernize-use-using): C compatibility
 typedef void (*Kokkos_Tools_toolInvokedFenceFunction)(const uint32_t);
 
@@ -252,7 +262,9 @@ struct Kokkos_Profiling_EventSet {
   Kokkos_Tools_provideToolProgrammingInterfaceFunction
       provide_tool_programming_interface;
   Kokkos_Tools_requestToolSettingsFunction request_tool_settings;
-  char profiling_padding[9 * sizeof(Kokkos_Tools_functionPointer)];
+  Kokkos_Profiling_threadWorkFunction thread_work;
+  Kokkos_Profiling_kernelWorkFunction kernel_work;
+  char profiling_padding[7 * sizeof(Kokkos_Tools_functionPointer)];
   Kokkos_Tools_outputTypeDeclarationFunction declare_output_type;
   Kokkos_Tools_inputTypeDeclarationFunction declare_input_type;
   Kokkos_Tools_requestValueFunction request_output_values;
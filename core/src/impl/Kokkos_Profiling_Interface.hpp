@@ -168,6 +168,8 @@ using endFenceFunction        = Kokkos_Profiling_endFenceFunction;
 using dualViewSyncFunction    = Kokkos_Profiling_dualViewSyncFunction;
 using dualViewModifyFunction  = Kokkos_Profiling_dualViewModifyFunction;
 using declareMetadataFunction = Kokkos_Profiling_declareMetadataFunction;
+using threadWorkFunction      = Kokkos_Profiling_threadWorkFunction;
+using kernelWorkFunction      = Kokkos_Profiling_kernelWorkFunction;
 
 }  // namespace Tools
 
@@ -29,6 +29,7 @@
 #include <cxxabi.h>
 #endif  // KOKKOS_ENABLE_CXXABI
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include <tuple>
@@ -92,12 +93,17 @@ class Stacktrace {
   static int length;
 
   static std::vector<std::string> lines() {
-    char** symbols = backtrace_symbols(buffer, length);
+    return symbol_lines(buffer, length);
+  }
+
+  static std::vector<std::string> symbol_lines(void* const* frames,
+                                               int num_frames) {
+    char** symbols = backtrace_symbols(frames, num_frames);
     if (symbols == nullptr) {
       return {};
     } else {
-      std::vector<std::string> trace(length);
-      for (int i = 0; i < length; ++i) {
+      std::vector<std::string> trace(num_frames);
+      for (int i = 0; i < num_frames; ++i) {
         if (symbols[i] != nullptr) {
           trace[i] = std::string(symbols[i]);
         }
@@ -115,6 +121,17 @@ void save_stacktrace() {
   Stacktrace::length = backtrace(Stacktrace::buffer, Stacktrace::capacity);
 }
 
+int save_stacktrace(void** frames, int capacity) {
+  // one more frame for this function, which is dropped
+  void* buffer[Stacktrace::capacity + 1];
+  int const length =
+      backtrace(buffer, std::min(capacity, Stacktrace::capacity) + 1);
+  for (int i = 1; i < length; ++i) {
+    frames[i - 1] = buffer[i];
+  }
+  return length > 0 ? length - 1 : 0;
+}
+
 size_t find_first_non_whitespace(const std::string& s, const size_t start_pos) {
   constexpr size_t num_ws_chars = 3;
   const char ws_chars[]         = "\n\t ";
@@ -218,6 +235,11 @@ void print_demangled_saved_stacktrace(std::ostream& out) {
   demangle_and_print_traceback(out, Stacktrace::lines());
 }
 
+void print_demangled_stacktrace(std::ostream& out, void* const* frames,
+                                int length) {
+  demangle_and_print_traceback(out, Stacktrace::symbol_lines(frames, length));
+}
+
 std::function<void()> user_terminate_handler_post_ = nullptr;
 
 void kokkos_terminate_handler() {
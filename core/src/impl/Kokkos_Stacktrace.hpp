@@ -35,6 +35,20 @@ std::string demangle(const std::string& name);
 /// call.
 void save_stacktrace();
 
+/// \brief Save the return addresses of the current call stack,
+///   innermost first and starting at the caller, to frames.
+///
+/// Unlike save_stacktrace(), this may be called concurrently and does
+/// not look up the symbols, so it is cheap enough to call often.
+/// Returns the number of frames saved, at most capacity, or zero if
+/// stacktraces are not supported.
+int save_stacktrace(void** frames, int capacity);
+
+/// \brief Print the demangled form of the given frames, as saved by
+///   save_stacktrace(frames, capacity), to the given output stream.
+void print_demangled_stacktrace(std::ostream& out, void* const* frames,
+                                int length);
+
 /// \brief Print the raw form of the currently saved stacktrace, if
 ///   any, to the given output stream.
 void print_saved_stacktrace(std::ostream& out);
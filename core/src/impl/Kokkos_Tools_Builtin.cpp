@@ -0,0 +1,2239 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Tools_Builtin.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
+#include <impl/Kokkos_Stacktrace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since(clock_type::time_point start,
+                     clock_type::time_point end) {
+  return std::chrono::duration<double>(end - start).count();
+}
+
+std::string output_prefix() {
+  char const* prefix = std::getenv("KOKKOS_TOOLS_BUILTIN_OUTPUT");
+  if (prefix != nullptr && *prefix != '\0') return prefix;
+#ifdef _WIN32
+  int const pid = _getpid();
+#else
+  int const pid = getpid();
+#endif
+  return "kokkos-tools-" + std::to_string(pid);
+}
+
+std::string json_escape(std::string const& s) {
+  std::string escaped;
+  escaped.reserve(s.size());
+  for (char c : s) {
+    switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+          escaped += buf;
+        } else {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
+// With sampling, count and total are estimates for all launches while the
+// other statistics are taken over the sampled launches. The busy times are
+// summed over the launches for which the backend reported the work of each
+// thread, their ratio is the load imbalance. Bytes, flops and work time only
+// cover the launches the user declared the work of with ScopedKernelWork.
+// They are only compared to the host peak if no launch ran on a device.
+struct TimerStats {
+  std::uint64_t samples = 0;
+  double count          = 0.;
+  double total          = 0.;
+  double sampled_total  = 0.;
+  double min            = std::numeric_limits<double>::max();
+  double max            = 0.;
+  double busy_max       = 0.;
+  double busy_mean      = 0.;
+  double bytes          = 0.;
+  double flops          = 0.;
+  double work_time      = 0.;
+  bool on_device        = false;
+
+  void add(double t, double weight) {
+    ++samples;
+    count += weight;
+    total += weight * t;
+    sampled_total += t;
+    min = std::min(min, t);
+    max = std::max(max, t);
+  }
+  void merge(TimerStats const& other) {
+    samples += other.samples;
+    count += other.count;
+    total += other.total;
+    sampled_total += other.sampled_total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    busy_max += other.busy_max;
+    busy_mean += other.busy_mean;
+    bytes += other.bytes;
+    flops += other.flops;
+    work_time += other.work_time;
+    on_device |= other.on_device;
+  }
+  double avg() const { return sampled_total / samples; }
+  // slowest thread over average thread, 1 for a perfect balance
+  double imbalance() const {
+    return busy_mean > 0. ? busy_max / busy_mean : 0.;
+  }
+  bool has_work() const { return work_time > 0.; }
+  bool has_host_work() const { return has_work() && !on_device; }
+  double bandwidth() const { return bytes / work_time; }
+  double flop_rate() const { return flops / work_time; }
+};
+
+enum EventKind : std::uint64_t {
+  kind_parallel_for,
+  kind_parallel_reduce,
+  kind_parallel_scan,
+  kind_region,
+  kind_fence,
+  kind_deep_copy,
+  num_kinds
+};
+
+constexpr char const* event_kind_names[num_kinds] = {
+    "parallel_for", "parallel_reduce", "parallel_scan",
+    "region",       "fence",           "deep_copy"};
+
+// Bandwidth and flop rate of the host the rates of the host kernels are
+// compared to, measured with a triad over arrays larger than most last level
+// caches and with independent multiply-add chains on every thread of the
+// default host execution space.
+struct HostPeak {
+  unsigned num_threads    = 0;
+  double bytes_per_second = 0.;
+  double flops_per_second = 0.;
+
+  // fraction of the roofline bound min(peak flops, intensity * peak bandwidth)
+  double roofline_fraction(TimerStats const& s) const {
+    return std::max(s.bandwidth() / bytes_per_second,
+                    s.flop_rate() / flops_per_second);
+  }
+};
+
+bool is_host_device(std::uint32_t device_id) {
+  using Kokkos::Tools::Experimental::DeviceType;
+  switch (Kokkos::Tools::Experimental::identifier_from_devid(device_id).type) {
+    case DeviceType::Serial:
+    case DeviceType::OpenMP:
+    case DeviceType::Threads:
+    case DeviceType::HPX: return true;
+    default: return false;
+  }
+}
+
+// Runs body(t) for every thread t of the default host execution space, one
+// call per thread, and returns the best time of three runs
+template <class Body>
+double best_parallel_time(unsigned num_threads, Body const& body) {
+  using policy_type =
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace,
+                          Kokkos::Schedule<Kokkos::Static>,
+                          Kokkos::IndexType<unsigned>>;
+  Kokkos::DefaultHostExecutionSpace const space;
+  double best = std::numeric_limits<double>::max();
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    auto const start = clock_type::now();
+    Kokkos::parallel_for(
+        "Kokkos::Tools::builtin::host_peak",
+        policy_type(space, 0, num_threads, Kokkos::ChunkSize(1)), body);
+    space.fence("Kokkos::Tools::builtin::host_peak");
+    best = std::min(best, seconds_since(start, clock_type::now()));
+  }
+  return best;
+}
+
+// The tools are paused so that the measurement does not show up as kernels
+// of the application.
+HostPeak measure_host_peak() {
+  Kokkos::Tools::Experimental::pause_tools();
+  HostPeak peak;
+  peak.num_threads =
+      std::max(1, Kokkos::DefaultHostExecutionSpace().concurrency());
+  unsigned const num_threads = peak.num_threads;
+
+  std::size_t const n = std::size_t(1) << 22;
+  std::unique_ptr<double[]> a(new double[n]);
+  std::unique_ptr<double[]> b(new double[n]);
+  std::unique_ptr<double[]> c(new double[n]);
+  auto slice = [&](unsigned t, auto const& f) {
+    for (std::size_t i = n * t / num_threads; i < n * (t + 1) / num_threads;
+         ++i) {
+      f(i);
+    }
+  };
+  // first touch by the threads that run the triad
+  best_parallel_time(num_threads, [&](unsigned t) {
+    slice(t, [&](std::size_t i) {
+      a[i] = 0.;
+      b[i] = 1.;
+      c[i] = 2.;
+    });
+  });
+  double const triad = best_parallel_time(num_threads, [&](unsigned t) {
+    slice(t, [&](std::size_t i) { a[i] = b[i] + 3. * c[i]; });
+  });
+  peak.bytes_per_second = 3. * sizeof(double) * n / triad;
+
+  constexpr int chains        = 32;
+  constexpr std::size_t steps = std::size_t(1) << 20;
+  std::vector<double> sums(num_threads);
+  double const madd = best_parallel_time(num_threads, [&](unsigned t) {
+    double acc[chains];
+    for (int j = 0; j < chains; ++j) acc[j] = j;
+    for (std::size_t i = 0; i < steps; ++i) {
+      for (int j = 0; j < chains; ++j) acc[j] = acc[j] * 0.999999 + 1e-6;
+    }
+    for (int j = 0; j < chains; ++j) sums[t] += acc[j];
+  });
+  peak.flops_per_second = 2. * chains * steps * num_threads / madd;
+  Kokkos::Tools::Experimental::resume_tools();
+  return peak;
+}
+
+struct TimerEntry {
+  std::string const* name = nullptr;
+  TimerStats stats;
+};
+
+// Records the duration of every kernel and region. Entries are indexed by the
+// interned id of the name and the kind of kernel. Kernels begin and end on
+// the same thread, so the start times are kept on thread local stacks and a
+// launch does not allocate once the stacks and entries have grown. Every
+// thread accumulates into its own entries, the mutex is only taken the first
+// time a thread closes a kernel or region and when the entries of all threads
+// are merged for the report.
+class KernelTimer {
+  struct Open {
+    std::uint64_t index;
+    std::string const* name;
+    clock_type::time_point start;
+    double busy_max  = 0.;
+    double busy_mean = 0.;
+    double bytes     = 0.;
+    double flops     = 0.;
+    bool on_device   = false;
+  };
+
+  std::mutex m_mutex;
+  clock_type::time_point m_start = clock_type::now();
+  unsigned m_generation;
+  std::vector<std::unique_ptr<std::vector<TimerEntry>>> m_thread_entries;
+  std::vector<TimerEntry> m_entries;
+  std::unique_ptr<HostPeak> m_peak;
+
+  std::vector<TimerEntry>& thread_entries() {
+    // the generation tells apart timers of repeated initializations
+    static thread_local unsigned generation              = 0;
+    static thread_local std::vector<TimerEntry>* entries = nullptr;
+    if (generation != m_generation) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_thread_entries.push_back(std::make_unique<std::vector<TimerEntry>>());
+      entries    = m_thread_entries.back().get();
+      generation = m_generation;
+    }
+    return *entries;
+  }
+
+  // sums the entries of all threads, called with the mutex held
+  void merge() {
+    m_entries.clear();
+    for (auto const& entries : m_thread_entries) {
+      if (entries->size() > m_entries.size()) {
+        m_entries.resize(entries->size());
+      }
+      for (std::size_t i = 0; i < entries->size(); ++i) {
+        if ((*entries)[i].stats.samples == 0) continue;
+        m_entries[i].name = (*entries)[i].name;
+        m_entries[i].stats.merge((*entries)[i].stats);
+      }
+    }
+  }
+
+  static std::vector<Open>& kernel_stack() {
+    static thread_local std::vector<Open> stack;
+    return stack;
+  }
+  static std::vector<Open>& region_stack() {
+    static thread_local std::vector<Open> stack;
+    return stack;
+  }
+
+  static void open(std::vector<Open>& stack, char const* name,
+                   EventKind kind) {
+    auto const interned = Kokkos::Tools::Impl::intern_kernel_name(name);
+    stack.push_back(
+        {interned.id * num_kinds + kind, interned.name, {}, 0., 0., 0., 0.});
+    // take the time last to keep the bookkeeping out of the measurement
+    stack.back().start = clock_type::now();
+  }
+
+  void close(std::vector<Open>& stack) {
+    auto const end = clock_type::now();
+    if (stack.empty()) return;
+    Open const open = stack.back();
+    stack.pop_back();
+    auto& entries = thread_entries();
+    if (open.index >= entries.size()) entries.resize(open.index + 1);
+    entries[open.index].name = open.name;
+    auto& stats              = entries[open.index].stats;
+    // regions are never sampled
+    double const weight = open.index % num_kinds == kind_region
+                              ? 1.
+                              : Kokkos::Tools::Impl::sampling_weight(
+                                    stats.samples);
+    double const t = seconds_since(open.start, end);
+    stats.add(t, weight);
+    stats.busy_max += open.busy_max;
+    stats.busy_mean += open.busy_mean;
+    stats.on_device |= open.on_device;
+    if (open.bytes > 0. || open.flops > 0.) {
+      stats.bytes += weight * open.bytes;
+      stats.flops += weight * open.flops;
+      stats.work_time += weight * t;
+    }
+  }
+
+  // The peak is only measured, at finalize, if a host kernel declared its work,
+  // as the measurement takes a fraction of a second.
+  HostPeak const* host_peak() {
+    if (!m_peak) {
+      bool any_work = false;
+      for (auto const& entry : m_entries) {
+        any_work |= entry.stats.has_host_work();
+      }
+      if (!any_work) return nullptr;
+      m_peak = std::make_unique<HostPeak>(measure_host_peak());
+    }
+    return m_peak.get();
+  }
+
+  std::vector<TimerEntry const*> sorted(bool regions) const {
+    std::vector<TimerEntry const*> result;
+    for (std::size_t i = 0; i < m_entries.size(); ++i) {
+      if (m_entries[i].stats.samples > 0 &&
+          (i % num_kinds == kind_region) == regions) {
+        result.push_back(&m_entries[i]);
+      }
+    }
+    std::sort(result.begin(), result.end(), [](auto const* l, auto const* r) {
+      return l->stats.total > r->stats.total;
+    });
+    return result;
+  }
+
+  char const* kind_name(TimerEntry const* entry) const {
+    return event_kind_names[(entry - m_entries.data()) % num_kinds];
+  }
+
+ public:
+  KernelTimer() {
+    static std::atomic<unsigned> generations{0};
+    m_generation = ++generations;
+  }
+
+  void begin_kernel(EventKind kind, char const* name, std::uint32_t device_id,
+                    std::uint64_t* id) {
+    auto& stack = kernel_stack();
+    open(stack, name, kind);
+    stack.back().on_device = !is_host_device(device_id);
+    *id                    = stack.back().index;
+  }
+  void end_kernel(std::uint64_t) { close(kernel_stack()); }
+  void thread_work(std::uint32_t num_threads, double const* busy_seconds) {
+    auto& stack = kernel_stack();
+    if (stack.empty() || num_threads == 0) return;
+    double max = 0., sum = 0.;
+    for (std::uint32_t i = 0; i < num_threads; ++i) {
+      max = std::max(max, busy_seconds[i]);
+      sum += busy_seconds[i];
+    }
+    stack.back().busy_max  = max;
+    stack.back().busy_mean = sum / num_threads;
+  }
+  void kernel_work(double bytes, double flops) {
+    auto& stack = kernel_stack();
+    if (stack.empty()) return;
+    stack.back().bytes += bytes;
+    stack.back().flops += flops;
+  }
+  void push_region(char const* name) {
+    open(region_stack(), name, kind_region);
+  }
+  void pop_region() { close(region_stack()); }
+
+  void write_text(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    merge();
+    double const wall  = seconds_since(m_start, clock_type::now());
+    double kernel_time = 0.;
+    for (auto const* entry : sorted(false)) {
+      kernel_time += entry->stats.total;
+    }
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "Kokkos builtin timer: %.6f s in kernels, %.6f s since "
+                  "initialization (%.2f%%)\n",
+                  kernel_time, wall,
+                  wall > 0. ? 100. * kernel_time / wall : 0.);
+    out << line;
+    if (Kokkos::Tools::Impl::sampling_enabled()) {
+      out << "Kernel launches are sampled, counts and totals are estimates\n";
+    }
+    auto const* peak = host_peak();
+    if (peak) {
+      std::snprintf(line, sizeof(line),
+                    "Host peak: %.2f GB/s, %.2f GFLOP/s on %u threads\n",
+                    1e-9 * peak->bytes_per_second,
+                    1e-9 * peak->flops_per_second, peak->num_threads);
+      out << line;
+    }
+    auto print = [&](char const* title, bool regions) {
+      out << '\n' << title << ":\n";
+      std::snprintf(line, sizeof(line),
+                    "  %-16s %10s %12s %12s %12s %12s %10s %10s %10s %7s  "
+                    "%s\n",
+                    "type", "count", "total [s]", "avg [s]", "min [s]",
+                    "max [s]", "imbalance", "GB/s", "GFLOP/s", "%peak",
+                    "name");
+      out << line;
+      for (auto const* entry : sorted(regions)) {
+        auto const& s = entry->stats;
+        std::snprintf(line, sizeof(line),
+                      "  %-16s %10.0f %12.6f %12.6e %12.6e %12.6e ",
+                      kind_name(entry), s.count, s.total, s.avg(), s.min,
+                      s.max);
+        out << line;
+        if (s.imbalance() > 0.) {
+          std::snprintf(line, sizeof(line), "%10.2f ", s.imbalance());
+        } else {
+          std::snprintf(line, sizeof(line), "%10s ", "-");
+        }
+        out << line;
+        if (s.has_host_work()) {
+          std::snprintf(line, sizeof(line), "%10.3f %10.3f %7.1f  ",
+                        1e-9 * s.bandwidth(), 1e-9 * s.flop_rate(),
+                        100. * peak->roofline_fraction(s));
+        } else if (s.has_work()) {
+          std::snprintf(line, sizeof(line), "%10.3f %10.3f %7s  ",
+                        1e-9 * s.bandwidth(), 1e-9 * s.flop_rate(), "-");
+        } else {
+          std::snprintf(line, sizeof(line), "%10s %10s %7s  ", "-", "-", "-");
+        }
+        out << line << *entry->name << '\n';
+      }
+    };
+    print("Kernels", false);
+    print("Regions", true);
+  }
+
+  void write_json(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    merge();
+    auto const* peak = host_peak();
+    auto print = [&](char const* title, bool regions) {
+      out << "  \"" << title << "\": [";
+      char const* separator = "\n";
+      for (auto const* entry : sorted(regions)) {
+        auto const& s = entry->stats;
+        out << separator << "    {\"name\": \"" << json_escape(*entry->name)
+            << "\", \"type\": \"" << kind_name(entry) << "\", \"count\": "
+            << s.count << ", \"samples\": " << s.samples
+            << ", \"total\": " << s.total << ", \"avg\": " << s.avg()
+            << ", \"min\": " << s.min << ", \"max\": " << s.max;
+        if (s.imbalance() > 0.) out << ", \"imbalance\": " << s.imbalance();
+        if (s.has_work()) {
+          out << ", \"bytes\": " << s.bytes << ", \"flops\": " << s.flops
+              << ", \"bandwidth\": " << s.bandwidth()
+              << ", \"flop_rate\": " << s.flop_rate();
+        }
+        if (s.has_host_work()) {
+          out << ", \"roofline_fraction\": " << peak->roofline_fraction(s);
+        }
+        out << "}";
+        separator = ",\n";
+      }
+      out << "\n  ]";
+    };
+    out.precision(9);
+    out << "{\n  \"wall_time\": " << seconds_since(m_start, clock_type::now())
+        << ",\n";
+    if (peak) {
+      out << "  \"host_peak\": {\"threads\": " << peak->num_threads
+          << ", \"bandwidth\": " << peak->bytes_per_second
+          << ", \"flop_rate\": " << peak->flops_per_second << "},\n";
+    }
+    print("kernels", false);
+    out << ",\n";
+    print("regions", true);
+    out << "\n}\n";
+  }
+};
+
+char const* device_type_name(Kokkos::Tools::Experimental::DeviceType type) {
+  using Kokkos::Tools::Experimental::DeviceType;
+  switch (type) {
+    case DeviceType::Serial: return "Serial";
+    case DeviceType::OpenMP: return "OpenMP";
+    case DeviceType::Cuda: return "Cuda";
+    case DeviceType::HIP: return "HIP";
+    case DeviceType::OpenMPTarget: return "OpenMPTarget";
+    case DeviceType::HPX: return "HPX";
+    case DeviceType::Threads: return "Threads";
+    case DeviceType::SYCL: return "SYCL";
+    case DeviceType::OpenACC: return "OpenACC";
+    default: return "Unknown";
+  }
+}
+
+// A completed kernel, fence, deep copy or region. The strings are interned
+// and live until the end of the program.
+struct TraceEvent {
+  EventKind kind;
+  std::uint32_t device_id;
+  std::string const* name;
+  // source label, destination and source spaces and size of deep copies
+  std::string const* src_name;
+  std::string const* dst_space;
+  std::string const* src_space;
+  std::uint64_t bytes;
+  clock_type::time_point begin;
+  clock_type::time_point end;
+};
+
+// Events of one host thread. Once the buffer holds its capacity the oldest
+// events are overwritten, so the trace keeps the end of long runs.
+struct TraceBuffer {
+  int thread;
+  std::size_t capacity;
+  std::uint64_t recorded = 0;
+  std::vector<TraceEvent> events;
+  std::vector<TraceEvent> open;
+  std::vector<TraceEvent> open_regions;
+
+  void record(TraceEvent const& event) {
+    if (events.size() < capacity) {
+      events.push_back(event);
+    } else {
+      events[recorded % capacity] = event;
+    }
+    ++recorded;
+  }
+};
+
+// Records a timeline of kernels, fences and deep copies per execution space
+// instance and host thread, plus the profiling regions, and writes it in the
+// Chrome trace event format that chrome://tracing and Perfetto read. Every
+// thread records into its own buffer, the mutex is only taken the first time
+// a thread records an event.
+class Tracer {
+  std::mutex m_mutex;
+  clock_type::time_point m_start = clock_type::now();
+  std::size_t m_capacity;
+  unsigned m_generation;
+  std::vector<std::unique_ptr<TraceBuffer>> m_buffers;
+
+  TraceBuffer& buffer() {
+    // the generation tells apart tracers of repeated initializations
+    static thread_local unsigned generation = 0;
+    static thread_local TraceBuffer* buffer = nullptr;
+    if (generation != m_generation) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_buffers.push_back(std::make_unique<TraceBuffer>());
+      buffer           = m_buffers.back().get();
+      buffer->thread   = static_cast<int>(m_buffers.size()) - 1;
+      buffer->capacity = m_capacity;
+      generation       = m_generation;
+    }
+    return *buffer;
+  }
+
+  static std::string const* intern(char const* name) {
+    return Kokkos::Tools::Impl::intern_kernel_name(name).name;
+  }
+
+  static void open(std::vector<TraceEvent>& stack, TraceEvent const& event) {
+    stack.push_back(event);
+    stack.back().begin = clock_type::now();
+  }
+
+  void close(std::vector<TraceEvent>& stack) {
+    auto const end = clock_type::now();
+    if (stack.empty()) return;
+    TraceEvent event = stack.back();
+    stack.pop_back();
+    event.end = end;
+    buffer().record(event);
+  }
+
+  double microseconds(clock_type::time_point t) const {
+    return std::chrono::duration<double, std::micro>(t - m_start).count();
+  }
+
+  // regions and deep copies have no execution space and go to process 0
+  static std::uint64_t pid(TraceEvent const& event) {
+    return event.kind == kind_region || event.kind == kind_deep_copy
+               ? 0
+               : std::uint64_t(event.device_id) + 1;
+  }
+
+ public:
+  explicit Tracer(std::size_t capacity) : m_capacity(capacity) {
+    static std::atomic<unsigned> generations{0};
+    m_generation = ++generations;
+  }
+
+  void begin(EventKind kind, char const* name, std::uint32_t device_id) {
+    open(buffer().open,
+         {kind, device_id, intern(name), nullptr, nullptr, nullptr, 0, {}, {}});
+  }
+  void end() { close(buffer().open); }
+  void begin_deep_copy(Kokkos::Tools::SpaceHandle dst_handle,
+                       char const* dst_name,
+                       Kokkos::Tools::SpaceHandle src_handle,
+                       char const* src_name, std::uint64_t size) {
+    open(buffer().open,
+         {kind_deep_copy, 0, intern(dst_name), intern(src_name),
+          intern(dst_handle.name), intern(src_handle.name), size, {}, {}});
+  }
+  void push_region(char const* name) {
+    open(buffer().open_regions,
+         {kind_region, 0, intern(name), nullptr, nullptr, nullptr, 0, {}, {}});
+  }
+  void pop_region() { close(buffer().open_regions); }
+
+  void write_json(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    char const* separator = "\n";
+    auto metadata = [&](char const* what, std::uint64_t pid, int tid,
+                        std::string const& name) {
+      out << separator << "  {\"name\": \"" << what
+          << "\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << tid
+          << ", \"args\": {\"name\": \"" << json_escape(name) << "\"}}";
+      separator = ",\n";
+    };
+
+    std::uint64_t dropped = 0;
+    std::vector<std::uint32_t> device_ids;
+    for (auto const& buffer : m_buffers) {
+      dropped += buffer->recorded - buffer->events.size();
+      for (auto const& event : buffer->events) {
+        if (pid(event) != 0) device_ids.push_back(event.device_id);
+      }
+    }
+    std::sort(device_ids.begin(), device_ids.end());
+    device_ids.erase(std::unique(device_ids.begin(), device_ids.end()),
+                     device_ids.end());
+
+    out.precision(3);
+    out << std::fixed << "{\"traceEvents\": [";
+    metadata("process_name", 0, 0, "Host");
+    for (auto id : device_ids) {
+      auto const space =
+          Kokkos::Tools::Experimental::identifier_from_devid(id);
+      metadata("process_name", std::uint64_t(id) + 1, 0,
+               std::string(device_type_name(space.type)) + " device " +
+                   std::to_string(space.device_id) + " instance " +
+                   std::to_string(space.instance_id));
+    }
+    for (auto const& buffer : m_buffers) {
+      metadata("thread_name", 0, buffer->thread,
+               "thread " + std::to_string(buffer->thread));
+      for (auto id : device_ids) {
+        metadata("thread_name", std::uint64_t(id) + 1, buffer->thread,
+                 "thread " + std::to_string(buffer->thread));
+      }
+    }
+    for (auto const& buffer : m_buffers) {
+      auto const& events = buffer->events;
+      // oldest event first
+      std::size_t const first = buffer->recorded % buffer->capacity;
+      for (std::size_t i = 0; i < events.size(); ++i) {
+        auto const& event =
+            events.size() < buffer->capacity
+                ? events[i]
+                : events[(first + i) % buffer->capacity];
+        out << ",\n  {\"name\": \"" << json_escape(*event.name)
+            << "\", \"cat\": \"" << event_kind_names[event.kind]
+            << "\", \"ph\": \"X\", \"ts\": " << microseconds(event.begin)
+            << ", \"dur\": "
+            << std::chrono::duration<double, std::micro>(event.end -
+                                                         event.begin)
+                   .count()
+            << ", \"pid\": " << pid(event) << ", \"tid\": " << buffer->thread;
+        if (event.kind == kind_deep_copy) {
+          out << ", \"args\": {\"src\": \"" << json_escape(*event.src_name)
+              << "\", \"dst_space\": \"" << json_escape(*event.dst_space)
+              << "\", \"src_space\": \"" << json_escape(*event.src_space)
+              << "\", \"bytes\": " << event.bytes << "}";
+        }
+        out << "}";
+      }
+    }
+    out << "\n],\n\"displayTimeUnit\": \"ns\",\n\"otherData\": "
+        << "{\"dropped_events\": " << dropped
+        << ", \"events_per_thread\": " << m_capacity << "}}\n";
+  }
+};
+
+std::size_t trace_buffer_capacity() {
+  char const* env = std::getenv("KOKKOS_TOOLS_BUILTIN_TRACE_EVENTS");
+  if (env != nullptr && *env != '\0') {
+    char* end;
+    auto const capacity = std::strtoull(env, &end, 10);
+    if (*end == '\0' && capacity > 0) return capacity;
+    std::cerr << "Warning: ignoring invalid KOKKOS_TOOLS_BUILTIN_TRACE_EVENTS='"
+              << env << "'" << std::endl;
+  }
+  return 1 << 16;
+}
+
+enum CounterId {
+  counter_cycles,
+  counter_instructions,
+  counter_llc_references,
+  counter_llc_misses,
+  counter_task_clock,
+  num_counters
+};
+
+constexpr char const* counter_names[num_counters] = {
+    "cycles", "instructions", "llc_references", "llc_misses", "task_clock"};
+
+// Opens a counter of the calling process' thread tid that counts in user
+// space on any cpu, as the leader of a new group if group is -1 or else as a
+// member of the group. Returns -1 if the counter is not available, e.g. in
+// virtual machines or if /proc/sys/kernel/perf_event_paranoid forbids it.
+int open_counter(CounterId counter, int tid, int group) {
+#ifdef __linux__
+  constexpr std::uint32_t types[num_counters] = {
+      PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE};
+  constexpr std::uint64_t configs[num_counters] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_SW_TASK_CLOCK};
+  perf_event_attr attr = {};
+  attr.size           = sizeof(attr);
+  attr.type           = types[counter];
+  attr.config         = configs[counter];
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, group,
+                                  PERF_FLAG_FD_CLOEXEC));
+#else
+  (void)counter;
+  (void)tid;
+  (void)group;
+  return -1;
+#endif
+}
+
+// Reads the num_values counters of the group led by fd, in the order they
+// were opened, with a single system call. The counts are scaled up by the
+// fraction of time the group was not scheduled when there are more counters
+// than hardware registers.
+void read_group(int fd, int num_values, double* values) {
+  std::fill(values, values + num_values, 0.);
+#ifdef __linux__
+  // number of values, time enabled, time running and the values
+  std::uint64_t group[3 + num_counters];
+  auto const size = static_cast<ssize_t>((3 + num_values) * sizeof(group[0]));
+  if (read(fd, group, size) != size || group[2] == 0) return;
+  for (int i = 0; i < num_values; ++i) {
+    values[i] = static_cast<double>(group[3 + i]) * group[1] / group[2];
+  }
+#else
+  (void)fd;
+#endif
+}
+
+void close_counter(int fd) {
+#ifdef __linux__
+  close(fd);
+#else
+  (void)fd;
+#endif
+}
+
+// ids of the threads of this process, which include the threads of the host
+// backends once they are initialized
+std::vector<int> list_threads() {
+  std::vector<int> tids;
+#ifdef __linux__
+  if (DIR* dir = opendir("/proc/self/task")) {
+    while (dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] != '.') tids.push_back(std::atoi(entry->d_name));
+    }
+    closedir(dir);
+  }
+  std::sort(tids.begin(), tids.end());
+#endif
+  return tids;
+}
+
+struct CounterEntry {
+  std::string const* name = nullptr;
+  std::uint64_t samples   = 0;
+  double launches         = 0.;
+  // indexed by thread * num_counters + counter
+  std::vector<double> values;
+};
+
+// Reads hardware and software counters of all threads of the process around
+// every kernel and accumulates the differences per kernel name and thread.
+// The counters of a thread form a group, read with one system call.
+// The threads are the ones that exist when the tool is initialized, so
+// kernels launched concurrently from several threads are counted for each
+// of them. Counters that cannot be opened are reported as unavailable.
+class KernelCounters {
+  struct Open {
+    std::uint32_t id;
+    std::string const* name;
+    std::vector<double> values;
+  };
+  struct OpenStack {
+    std::vector<Open> open;
+    std::size_t depth = 0;
+    std::vector<double> values;
+  };
+
+  // the counters of a thread that could be opened, in the order of the group
+  struct Group {
+    int leader = -1;
+    int size   = 0;
+    CounterId counters[num_counters];
+  };
+
+  std::mutex m_mutex;
+  std::vector<int> m_threads;
+  std::vector<int> m_fds;
+  std::vector<Group> m_groups;
+  bool m_available[num_counters] = {};
+  std::vector<CounterEntry> m_entries;
+
+  static OpenStack& open_stack() {
+    static thread_local OpenStack stack;
+    return stack;
+  }
+
+  void read_all(std::vector<double>& values) const {
+    values.assign(m_fds.size(), 0.);
+    for (std::size_t t = 0; t < m_groups.size(); ++t) {
+      auto const& group = m_groups[t];
+      if (group.leader < 0) continue;
+      double group_values[num_counters];
+      read_group(group.leader, group.size, group_values);
+      for (int i = 0; i < group.size; ++i) {
+        values[t * num_counters + group.counters[i]] = group_values[i];
+      }
+    }
+  }
+
+  double total(CounterEntry const& entry, CounterId counter) const {
+    double sum = 0.;
+    for (std::size_t t = 0; t < m_threads.size(); ++t) {
+      sum += entry.values[t * num_counters + counter];
+    }
+    return sum;
+  }
+
+  std::vector<CounterEntry const*> sorted() const {
+    std::vector<CounterEntry const*> result;
+    for (auto const& entry : m_entries) {
+      if (entry.samples > 0) result.push_back(&entry);
+    }
+    CounterId const key =
+        m_available[counter_cycles] ? counter_cycles : counter_task_clock;
+    std::sort(result.begin(), result.end(), [&](auto const* l, auto const* r) {
+      return total(*l, key) > total(*r, key);
+    });
+    return result;
+  }
+
+  static double ratio(double numerator, double denominator) {
+    return denominator > 0. ? numerator / denominator : 0.;
+  }
+
+  // print the counters of one thread (thread >= 0) or of all threads
+  void print_values(std::ostream& out, CounterEntry const& entry,
+                    int thread) const {
+    double values[num_counters];
+    for (int c = 0; c < num_counters; ++c) {
+      values[c] = thread < 0 ? total(entry, CounterId(c))
+                             : entry.values[thread * num_counters + c];
+    }
+    char field[32];
+    auto print = [&](bool available, char const* format, double value) {
+      if (available) {
+        std::snprintf(field, sizeof(field), format, value);
+      } else {
+        std::snprintf(field, sizeof(field), "%12s", "-");
+      }
+      out << field << ' ';
+    };
+    bool const ipc = m_available[counter_cycles] &&
+                     m_available[counter_instructions];
+    bool const llc = m_available[counter_llc_references] &&
+                     m_available[counter_llc_misses];
+    print(m_available[counter_cycles], "%12.4e", values[counter_cycles]);
+    print(m_available[counter_instructions], "%12.4e",
+          values[counter_instructions]);
+    print(ipc, "%12.3f",
+          ratio(values[counter_instructions], values[counter_cycles]));
+    print(m_available[counter_llc_misses], "%12.4e",
+          values[counter_llc_misses]);
+    print(llc, "%12.4f",
+          ratio(values[counter_llc_misses], values[counter_llc_references]));
+    print(m_available[counter_llc_misses], "%12.4e",
+          64. * values[counter_llc_misses]);
+    print(m_available[counter_task_clock], "%12.6f",
+          1e-9 * values[counter_task_clock]);
+  }
+
+ public:
+  KernelCounters() : m_threads(list_threads()) {
+    m_fds.assign(m_threads.size() * num_counters, -1);
+    m_groups.resize(m_threads.size());
+    for (std::size_t t = 0; t < m_threads.size(); ++t) {
+      auto& group = m_groups[t];
+      for (int c = 0; c < num_counters; ++c) {
+        int const fd = open_counter(CounterId(c), m_threads[t], group.leader);
+        m_fds[t * num_counters + c] = fd;
+        if (fd < 0) continue;
+        if (group.leader < 0) group.leader = fd;
+        group.counters[group.size++] = CounterId(c);
+        m_available[c]               = true;
+      }
+    }
+    if (std::none_of(m_available, m_available + num_counters,
+                     [](bool available) { return available; })) {
+      std::cerr << "Warning: Kokkos builtin counters could not open any "
+                   "performance counter, only kernel launches are counted"
+                << std::endl;
+    }
+  }
+  ~KernelCounters() {
+    for (int fd : m_fds) {
+      if (fd >= 0) close_counter(fd);
+    }
+  }
+  KernelCounters(KernelCounters const&) = delete;
+  KernelCounters& operator=(KernelCounters const&) = delete;
+
+  void begin(char const* name) {
+    auto& stack = open_stack();
+    if (stack.depth == stack.open.size()) stack.open.emplace_back();
+    auto& open       = stack.open[stack.depth++];
+    auto const interned = Kokkos::Tools::Impl::intern_kernel_name(name);
+    open.id          = interned.id;
+    open.name        = interned.name;
+    // read last to keep the bookkeeping out of the counts
+    read_all(open.values);
+  }
+
+  void end() {
+    auto& stack = open_stack();
+    read_all(stack.values);
+    if (stack.depth == 0) return;
+    auto const& open = stack.open[--stack.depth];
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (open.id >= m_entries.size()) m_entries.resize(open.id + 1);
+    auto& entry = m_entries[open.id];
+    entry.name  = open.name;
+    entry.values.resize(m_fds.size());
+    double const weight = Kokkos::Tools::Impl::sampling_weight(entry.samples);
+    ++entry.samples;
+    entry.launches += weight;
+    for (std::size_t i = 0; i < m_fds.size(); ++i) {
+      entry.values[i] += weight * (stack.values[i] - open.values[i]);
+    }
+  }
+
+  void write_text(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    out << "Kokkos builtin counters, threads: " << m_threads.size()
+        << ", available:";
+    for (int c = 0; c < num_counters; ++c) {
+      if (m_available[c]) out << ' ' << counter_names[c];
+    }
+    out << "\nDRAM bytes are estimated as 64 bytes per last level cache "
+           "miss\n";
+    if (Kokkos::Tools::Impl::sampling_enabled()) {
+      out << "Kernel launches are sampled, counts are estimates\n";
+    }
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "\n  %-8s %10s %12s %12s %12s %12s %12s %12s %12s  %s\n",
+                  "thread", "launches", "cycles", "instructions", "IPC",
+                  "LLC misses", "miss rate", "DRAM bytes", "task [s]",
+                  "name");
+    out << line;
+    for (auto const* entry : sorted()) {
+      std::snprintf(line, sizeof(line), "  %-8s %10.0f ", "all",
+                    entry->launches);
+      out << line;
+      print_values(out, *entry, -1);
+      out << ' ' << *entry->name << '\n';
+      if (m_threads.size() < 2) continue;
+      for (std::size_t t = 0; t < m_threads.size(); ++t) {
+        bool active = false;
+        for (int c = 0; c < num_counters; ++c) {
+          active |= entry->values[t * num_counters + c] > 0.;
+        }
+        if (!active) continue;
+        std::snprintf(line, sizeof(line), "  %-8zu %10s ", t, "");
+        out << line;
+        print_values(out, *entry, static_cast<int>(t));
+        out << '\n';
+      }
+    }
+  }
+
+  void write_json(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto print_counters = [&](CounterEntry const& entry, int thread) {
+      char const* separator = "";
+      out << '{';
+      for (int c = 0; c < num_counters; ++c) {
+        if (!m_available[c]) continue;
+        out << separator << '"' << counter_names[c] << "\": "
+            << (thread < 0 ? total(entry, CounterId(c))
+                           : entry.values[thread * num_counters + c]);
+        separator = ", ";
+      }
+      out << '}';
+    };
+    out.precision(9);
+    out << "{\n  \"threads\": [";
+    for (std::size_t t = 0; t < m_threads.size(); ++t) {
+      out << (t == 0 ? "" : ", ") << m_threads[t];
+    }
+    out << "],\n  \"kernels\": [";
+    char const* separator = "\n";
+    for (auto const* entry : sorted()) {
+      out << separator << "    {\"name\": \"" << json_escape(*entry->name)
+          << "\", \"launches\": " << entry->launches
+          << ", \"samples\": " << entry->samples << ", \"counters\": ";
+      print_counters(*entry, -1);
+      out << ", \"per_thread\": [";
+      for (std::size_t t = 0; t < m_threads.size(); ++t) {
+        out << (t == 0 ? "" : ", ");
+        print_counters(*entry, static_cast<int>(t));
+      }
+      out << "]}";
+      separator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+
+std::string format_bytes(double bytes) {
+  char const* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  int unit            = 0;
+  while (bytes >= 1024. && unit < 4) {
+    bytes /= 1024.;
+    ++unit;
+  }
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), unit == 0 ? "%.0f %s" : "%.1f %s", bytes,
+                units[unit]);
+  return buf;
+}
+
+struct MemoryLabel {
+  std::string const* label      = nullptr;
+  std::uint64_t allocations     = 0;
+  std::uint64_t deallocations   = 0;
+  std::uint64_t bytes_allocated = 0;
+  std::uint64_t live            = 0;
+  std::uint64_t peak            = 0;
+};
+
+struct MemorySpaceUsage {
+  std::string const* name     = nullptr;
+  std::uint64_t live          = 0;
+  std::uint64_t peak          = 0;
+  double peak_time            = 0.;
+  std::uint64_t allocations   = 0;
+  std::uint64_t deallocations = 0;
+  std::vector<std::string const*> peak_regions;
+  // live bytes per label at the peak, taken when the peak is left
+  std::vector<std::pair<std::string const*, std::uint64_t>> peak_labels;
+  bool at_peak = false;
+  // indexed by the interned id of the label
+  std::vector<MemoryLabel> labels;
+
+  void snapshot_peak() {
+    peak_labels.clear();
+    for (auto const& label : labels) {
+      if (label.live > 0) peak_labels.emplace_back(label.label, label.live);
+    }
+    std::sort(peak_labels.begin(), peak_labels.end(),
+              [](auto const& l, auto const& r) { return l.second > r.second; });
+    at_peak = false;
+  }
+};
+
+// Tracks the live bytes per memory space and label. At the peak of a space
+// it keeps the regions that were active on the allocating thread and, once
+// the first deallocation leaves the peak, which labels made it up. That way
+// a growing peak does not copy the labels on every allocation.
+class MemoryProfiler {
+  std::mutex m_mutex;
+  clock_type::time_point m_start = clock_type::now();
+  std::vector<MemorySpaceUsage> m_spaces;
+
+  static std::vector<std::string const*>& region_stack() {
+    static thread_local std::vector<std::string const*> stack;
+    return stack;
+  }
+
+  MemorySpaceUsage& space(char const* name) {
+    auto const* interned = Kokkos::Tools::Impl::intern_kernel_name(name).name;
+    for (auto& space : m_spaces) {
+      if (space.name == interned) return space;
+    }
+    m_spaces.emplace_back();
+    m_spaces.back().name = interned;
+    return m_spaces.back();
+  }
+
+  static MemoryLabel& label(MemorySpaceUsage& space, char const* name) {
+    auto const interned = Kokkos::Tools::Impl::intern_kernel_name(name);
+    if (interned.id >= space.labels.size()) {
+      space.labels.resize(interned.id + 1);
+    }
+    auto& label = space.labels[interned.id];
+    label.label = interned.name;
+    return label;
+  }
+
+  std::vector<std::pair<MemorySpaceUsage const*, MemoryLabel const*>>
+  sorted_labels() const {
+    std::vector<std::pair<MemorySpaceUsage const*, MemoryLabel const*>> result;
+    for (auto const& space : m_spaces) {
+      for (auto const& label : space.labels) {
+        if (label.allocations > 0) result.emplace_back(&space, &label);
+      }
+    }
+    std::sort(result.begin(), result.end(), [](auto const& l, auto const& r) {
+      return l.second->allocations > r.second->allocations;
+    });
+    return result;
+  }
+
+  void finish_peaks() {
+    for (auto& space : m_spaces) {
+      if (space.at_peak) space.snapshot_peak();
+    }
+  }
+
+ public:
+  void allocate(Kokkos::Tools::SpaceHandle handle, char const* name,
+                std::uint64_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& usage = space(handle.name);
+    auto& entry = label(usage, name);
+    ++entry.allocations;
+    entry.bytes_allocated += size;
+    entry.live += size;
+    entry.peak = std::max(entry.peak, entry.live);
+    ++usage.allocations;
+    usage.live += size;
+    if (usage.live > usage.peak) {
+      usage.peak         = usage.live;
+      usage.peak_time    = seconds_since(m_start, clock_type::now());
+      usage.peak_regions = region_stack();
+      usage.at_peak      = true;
+    }
+  }
+
+  void deallocate(Kokkos::Tools::SpaceHandle handle, char const* name,
+                  std::uint64_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& usage = space(handle.name);
+    if (usage.at_peak) usage.snapshot_peak();
+    auto& entry = label(usage, name);
+    ++entry.deallocations;
+    ++usage.deallocations;
+    // allocations made before the tool was initialized are not known
+    entry.live -= std::min(entry.live, size);
+    usage.live -= std::min(usage.live, size);
+  }
+
+  void push_region(char const* name) {
+    region_stack().push_back(
+        Kokkos::Tools::Impl::intern_kernel_name(name).name);
+  }
+  void pop_region() {
+    auto& stack = region_stack();
+    if (!stack.empty()) stack.pop_back();
+  }
+
+  void write_text(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    finish_peaks();
+    double const wall = seconds_since(m_start, clock_type::now());
+    out << "Kokkos builtin memory profiler, " << wall
+        << " s since initialization\n";
+    char line[256];
+    for (auto const& space : m_spaces) {
+      out << "\nSpace " << *space.name << ": peak "
+          << format_bytes(space.peak) << " at " << space.peak_time
+          << " s, live at finalize " << format_bytes(space.live) << ", "
+          << space.allocations << " allocations, " << space.deallocations
+          << " deallocations\n  regions at peak:";
+      if (space.peak_regions.empty()) out << " none";
+      for (std::size_t i = 0; i < space.peak_regions.size(); ++i) {
+        out << (i == 0 ? " " : " / ") << *space.peak_regions[i];
+      }
+      out << "\n  labels at peak:\n";
+      for (auto const& label : space.peak_labels) {
+        std::snprintf(line, sizeof(line), "    %12s  ",
+                      format_bytes(label.second).c_str());
+        out << line << *label.first << '\n';
+      }
+    }
+    out << "\nAllocations per label:\n";
+    std::snprintf(line, sizeof(line),
+                  "  %-10s %12s %12s %12s %12s %12s %12s  %s\n", "space",
+                  "allocs", "deallocs", "allocs/s", "allocated", "peak",
+                  "live", "label");
+    out << line;
+    for (auto const& entry : sorted_labels()) {
+      auto const& label = *entry.second;
+      std::snprintf(line, sizeof(line),
+                    "  %-10s %12llu %12llu %12.1f %12s %12s %12s  ",
+                    entry.first->name->c_str(),
+                    static_cast<unsigned long long>(label.allocations),
+                    static_cast<unsigned long long>(label.deallocations),
+                    wall > 0. ? label.allocations / wall : 0.,
+                    format_bytes(label.bytes_allocated).c_str(),
+                    format_bytes(label.peak).c_str(),
+                    format_bytes(label.live).c_str());
+      out << line << *label.label << '\n';
+    }
+  }
+
+  void write_json(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    finish_peaks();
+    double const wall = seconds_since(m_start, clock_type::now());
+    out.precision(9);
+    out << "{\n  \"wall_time\": " << wall << ",\n  \"spaces\": [";
+    char const* separator = "\n";
+    for (auto const& space : m_spaces) {
+      out << separator << "    {\"name\": \"" << json_escape(*space.name)
+          << "\", \"peak\": " << space.peak
+          << ", \"peak_time\": " << space.peak_time
+          << ", \"live\": " << space.live
+          << ", \"allocations\": " << space.allocations
+          << ", \"deallocations\": " << space.deallocations
+          << ", \"peak_regions\": [";
+      for (std::size_t i = 0; i < space.peak_regions.size(); ++i) {
+        out << (i == 0 ? "\"" : ", \"") << json_escape(*space.peak_regions[i])
+            << '"';
+      }
+      out << "], \"peak_labels\": [";
+      for (std::size_t i = 0; i < space.peak_labels.size(); ++i) {
+        out << (i == 0 ? "" : ", ") << "{\"label\": \""
+            << json_escape(*space.peak_labels[i].first)
+            << "\", \"bytes\": " << space.peak_labels[i].second << "}";
+      }
+      out << "]}";
+      separator = ",\n";
+    }
+    out << "\n  ],\n  \"labels\": [";
+    separator = "\n";
+    for (auto const& entry : sorted_labels()) {
+      auto const& label = *entry.second;
+      out << separator << "    {\"space\": \""
+          << json_escape(*entry.first->name) << "\", \"label\": \""
+          << json_escape(*label.label)
+          << "\", \"allocations\": " << label.allocations
+          << ", \"deallocations\": " << label.deallocations
+          << ", \"allocation_rate\": "
+          << (wall > 0. ? label.allocations / wall : 0.)
+          << ", \"bytes_allocated\": " << label.bytes_allocated
+          << ", \"peak\": " << label.peak << ", \"live\": " << label.live
+          << "}";
+      separator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+
+// Global fences are reported with instance 0 and the fences of the resources
+// deep_copy uses with all instance bits set, see
+// int_for_synchronization_reason.
+bool is_global_fence(std::uint32_t device_id) {
+  using namespace Kokkos::Tools::Experimental;
+  auto const instance = identifier_from_devid(device_id).instance_id;
+  return instance == 0 || instance == (1u << num_instance_bits) - 1;
+}
+
+// The fences Kokkos issues around every kernel for tools that require global
+// fencing, see invoke_kokkosp_callback
+bool is_tool_fence(char const* name) {
+  return std::strstr(name, "Kokkos Profile Tool Fence") != nullptr;
+}
+
+struct FenceSite {
+  std::uint64_t count   = 0;
+  std::uint64_t no_work = 0;
+  double blocked        = 0.;
+  double max            = 0.;
+
+  void add(FenceSite const& other) {
+    count += other.count;
+    no_work += other.no_work;
+    blocked += other.blocked;
+    max = std::max(max, other.max);
+  }
+};
+
+// Counts the global fences by name, type of execution space and call stack,
+// and the time the calling thread was blocked in them. A fence found no
+// outstanding work if no kernel was launched on its type of execution space
+// and no deep copy ran since the previous global fence of that type. Within
+// deep_copy, the first fence of a type waits for the work before the copy and
+// the later ones for the copy itself. Fences of a single instance only wait
+// for it and are not audited, nor are the fences issued for other tools, which
+// the application would not have without them.
+class FenceAudit {
+  using DeviceType = Kokkos::Tools::Experimental::DeviceType;
+  static constexpr int max_frames       = 32;
+  static constexpr int num_device_types = int(DeviceType::Unknown) + 1;
+
+  struct Open {
+    bool global             = false;
+    bool no_work            = false;
+    DeviceType type         = DeviceType::Unknown;
+    std::string const* name = nullptr;
+    int num_frames          = 0;
+    void* frames[max_frames];
+    clock_type::time_point start;
+  };
+  // name, type of execution space and call stack
+  using SiteKey = std::tuple<std::string const*, int, std::vector<void*>>;
+  using SiteRef = std::pair<SiteKey const*, FenceSite const*>;
+
+  std::mutex m_mutex;
+  std::atomic<std::uint64_t> m_launches[num_device_types] = {};
+  std::uint64_t m_fenced[num_device_types]                = {};
+  std::map<SiteKey, FenceSite> m_sites;
+
+  static std::vector<Open>& fence_stack() {
+    static thread_local std::vector<Open> stack;
+    return stack;
+  }
+  // deep copies in progress on this thread and the types of execution space
+  // fenced since the outermost one began
+  struct CopyState {
+    int depth            = 0;
+    std::uint32_t fenced = 0;
+  };
+  static CopyState& copy_state() {
+    static thread_local CopyState state;
+    return state;
+  }
+
+  static DeviceType device_type(std::uint32_t device_id) {
+    return Kokkos::Tools::Experimental::identifier_from_devid(device_id).type;
+  }
+
+  std::vector<SiteRef> sorted_sites(FenceSite& total) const {
+    std::vector<SiteRef> result;
+    for (auto const& site : m_sites) {
+      result.emplace_back(&site.first, &site.second);
+      total.add(site.second);
+    }
+    std::sort(result.begin(), result.end(), [](auto const& l, auto const& r) {
+      return l.second->blocked != r.second->blocked
+                 ? l.second->blocked > r.second->blocked
+                 : l.second->count > r.second->count;
+    });
+    return result;
+  }
+
+  static std::vector<std::string> stack_lines(SiteKey const& key) {
+    auto const& frames = std::get<2>(key);
+    std::stringstream ss;
+    Kokkos::Impl::print_demangled_stacktrace(ss, frames.data(),
+                                             static_cast<int>(frames.size()));
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(ss, line);) lines.push_back(line);
+    return lines;
+  }
+
+  static char const* type_name(SiteKey const& key) {
+    return device_type_name(static_cast<DeviceType>(std::get<1>(key)));
+  }
+
+ public:
+  void launch(std::uint32_t device_id) {
+    m_launches[int(device_type(device_id))].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void begin_deep_copy() {
+    auto& copy = copy_state();
+    if (copy.depth++ == 0) copy.fenced = 0;
+  }
+  // copies are not tied to an execution space, so they count for all
+  void end_deep_copy() {
+    --copy_state().depth;
+    for (auto& launches : m_launches) {
+      launches.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void begin(char const* name, std::uint32_t device_id) {
+    auto& stack = fence_stack();
+    stack.emplace_back();
+    auto& open  = stack.back();
+    open.global = is_global_fence(device_id) && !is_tool_fence(name);
+    if (!open.global) return;
+    open.type = device_type(device_id);
+    open.name = Kokkos::Tools::Impl::intern_kernel_name(name).name;
+
+    auto& copy                = copy_state();
+    std::uint32_t const mask  = 1u << int(open.type);
+    bool const waits_for_copy = copy.depth > 0 && (copy.fenced & mask) != 0;
+    if (copy.depth > 0) copy.fenced |= mask;
+    bool launched = false;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto const launches      = m_launches[int(open.type)].load();
+      launched                 = launches != m_fenced[int(open.type)];
+      m_fenced[int(open.type)] = launches;
+    }
+    open.no_work    = !waits_for_copy && !launched;
+    open.num_frames = Kokkos::Impl::save_stacktrace(open.frames, max_frames);
+    open.start      = clock_type::now();
+  }
+
+  void end() {
+    auto const end = clock_type::now();
+    auto& stack    = fence_stack();
+    if (stack.empty()) return;
+    Open const& open = stack.back();
+    if (open.global) {
+      double const t = seconds_since(open.start, end);
+      SiteKey key(open.name, int(open.type),
+                  std::vector<void*>(open.frames,
+                                     open.frames + open.num_frames));
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto& site = m_sites[std::move(key)];
+      site.add({1, open.no_work ? 1u : 0u, t, t});
+    }
+    stack.pop_back();
+  }
+
+  void write_text(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FenceSite total;
+    auto const sites = sorted_sites(total);
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "Kokkos builtin fence audit: %llu global fences, %.6f s "
+                  "blocked, %llu found no outstanding work\n\n",
+                  static_cast<unsigned long long>(total.count), total.blocked,
+                  static_cast<unsigned long long>(total.no_work));
+    out << line;
+    std::snprintf(line, sizeof(line), "  %-5s %10s %12s %12s %10s  %-12s %s\n",
+                  "site", "count", "blocked [s]", "max [s]", "no work",
+                  "space", "name");
+    out << line;
+    for (std::size_t i = 0; i < sites.size(); ++i) {
+      auto const& site = *sites[i].second;
+      std::snprintf(line, sizeof(line),
+                    "  #%-4zu %10llu %12.6f %12.6e %10llu  %-12s ", i + 1,
+                    static_cast<unsigned long long>(site.count), site.blocked,
+                    site.max, static_cast<unsigned long long>(site.no_work),
+                    type_name(*sites[i].first));
+      out << line << *std::get<0>(*sites[i].first) << '\n';
+    }
+    out << "\nCall stacks, innermost first:\n";
+    for (std::size_t i = 0; i < sites.size(); ++i) {
+      out << "\n#" << i + 1 << ' ' << *std::get<0>(*sites[i].first) << '\n';
+      auto const lines = stack_lines(*sites[i].first);
+      if (lines.empty()) out << "  (stack traces are not available)\n";
+      for (auto const& frame : lines) out << "  " << frame << '\n';
+    }
+  }
+
+  void write_json(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FenceSite total;
+    auto const sites = sorted_sites(total);
+    out.precision(9);
+    out << "{\n  \"fences\": " << total.count
+        << ",\n  \"blocked\": " << total.blocked
+        << ",\n  \"no_work\": " << total.no_work << ",\n  \"sites\": [";
+    char const* separator = "\n";
+    for (auto const& entry : sites) {
+      auto const& site = *entry.second;
+      out << separator << "    {\"name\": \""
+          << json_escape(*std::get<0>(*entry.first)) << "\", \"space\": \""
+          << type_name(*entry.first) << "\", \"count\": " << site.count
+          << ", \"blocked\": " << site.blocked << ", \"max\": " << site.max
+          << ", \"no_work\": " << site.no_work << ", \"stack\": [";
+      char const* frame_separator = "";
+      for (auto const& frame : stack_lines(*entry.first)) {
+        out << frame_separator << '"' << json_escape(frame) << '"';
+        frame_separator = ", ";
+      }
+      out << "]}";
+      separator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+
+using TuningValue = decltype(Kokkos::Tools::Experimental::VariableValue::value);
+
+// Escapes the characters that separate the fields of the tuner file and the
+// values of a configuration.
+std::string tuner_escape(std::string const& s) {
+  std::string escaped;
+  for (char c : s) {
+    switch (c) {
+      case '\\': escaped += "\\\\"; break;
+      case ',': escaped += "\\,"; break;
+      case '\t': escaped += "\\t"; break;
+      case '\n': escaped += "\\n"; break;
+      default: escaped += c;
+    }
+  }
+  return escaped;
+}
+
+std::string tuning_value_text(Kokkos::Tools::Experimental::ValueType type,
+                              TuningValue const& value) {
+  using Kokkos::Tools::Experimental::ValueType;
+  char text[64];
+  switch (type) {
+    case ValueType::kokkos_value_int64:
+      std::snprintf(text, sizeof(text), "%lld",
+                    static_cast<long long>(value.int_value));
+      return text;
+    case ValueType::kokkos_value_double:
+      std::snprintf(text, sizeof(text), "%.17g", value.double_value);
+      return text;
+    default: return tuner_escape(value.string_value);
+  }
+}
+
+// A variable declared to the tuning interface with the values the builtin
+// tuner chooses from. Ranges are sampled at up to max_points points and
+// variables without candidates are not tuned.
+struct TuningVariable {
+  static constexpr std::size_t max_points = 64;
+
+  std::string name;
+  Kokkos::Tools::Experimental::ValueType type;
+  std::vector<TuningValue> candidates;
+  std::vector<std::string> texts;
+
+  TuningVariable(char const* variable_name,
+                 Kokkos::Tools::Experimental::VariableInfo const& info)
+      : name(variable_name), type(info.type) {
+    using namespace Kokkos::Tools::Experimental;
+    if (info.valueQuantity == CandidateValueType::kokkos_value_set) {
+      auto const& set = info.candidates.set;
+      for (std::size_t i = 0; i < set.size; ++i) {
+        TuningValue value{};
+        if (type == ValueType::kokkos_value_int64) {
+          value.int_value = set.values.int_value[i];
+        } else if (type == ValueType::kokkos_value_double) {
+          value.double_value = set.values.double_value[i];
+        } else {
+          std::strncpy(value.string_value, set.values.string_value[i],
+                       KOKKOS_TOOLS_TUNING_STRING_LENGTH - 1);
+        }
+        add(value);
+      }
+    } else if (info.valueQuantity == CandidateValueType::kokkos_value_range &&
+               type != ValueType::kokkos_value_string) {
+      add_range(info.candidates.range);
+    }
+  }
+
+ private:
+  void add(TuningValue const& value) {
+    auto text = tuning_value_text(type, value);
+    if (std::find(texts.begin(), texts.end(), text) != texts.end()) return;
+    candidates.push_back(value);
+    texts.push_back(std::move(text));
+  }
+
+  void add_range(Kokkos::Tools::Experimental::ValueRange const& range) {
+    bool const is_int =
+        type == Kokkos::Tools::Experimental::ValueType::kokkos_value_int64;
+    auto as_double = [&](TuningValue const& v) {
+      return is_int ? double(v.int_value) : v.double_value;
+    };
+    double const lower = as_double(range.lower);
+    double const upper = as_double(range.upper);
+    double step        = as_double(range.step);
+    if (!(upper >= lower)) return;
+    // a range without a step is sampled evenly
+    if (step <= 0.) step = (upper - lower) / (max_points - 1);
+    if (step <= 0.) step = 1.;
+    double const tolerance = 1e-9 * step;
+    std::vector<double> points;
+    for (std::size_t k = 0;; ++k) {
+      double const x = lower + k * step;
+      if (x > upper + tolerance) break;
+      if (range.openLower && x <= lower + tolerance) continue;
+      if (range.openUpper && x >= upper - tolerance) break;
+      points.push_back(x);
+    }
+    std::size_t const n = std::min(points.size(), max_points);
+    for (std::size_t i = 0; i < n; ++i) {
+      double const x = points[n > 1 ? i * (points.size() - 1) / (n - 1) : 0];
+      TuningValue value{};
+      if (is_int) {
+        value.int_value = static_cast<std::int64_t>(std::llround(x));
+      } else {
+        value.double_value = x;
+      }
+      add(value);
+    }
+  }
+};
+
+// Answers the requests of the tuning interface, e.g. the team sizes and
+// tile sizes Kokkos tunes with --kokkos-tune-internals and the choices of
+// CategoricalTuner. Each combination of output variables and input values
+// is a separate problem searched epsilon greedily: with probability epsilon,
+// or until warmup_arms configurations have been measured, a random
+// configuration is tried, preferring unmeasured ones, otherwise the one with
+// the lowest mean cost. The cost is the time from the begin to the end of
+// the context, or the declared optimization goal. The learned costs are read
+// from and written to a file, so repeated runs start from the best known
+// choices.
+class Autotuner {
+  struct Arm {
+    std::uint64_t samples = 0;
+    double mean           = 0.;
+  };
+  struct Problem {
+    std::map<std::string, Arm> arms;  // by configuration
+    std::string best;
+    std::uint64_t samples = 0;
+  };
+  struct OpenContext {
+    clock_type::time_point start = clock_type::now();
+    std::string key;
+    std::string configuration;
+    bool has_goal = false;
+    bool maximize = false;
+  };
+
+  // configurations measured before the best known one is used
+  static constexpr std::size_t warmup_arms    = 16;
+  static constexpr std::size_t max_enumerated = 1024;
+  // launches of a problem after which the exploration rate decays as 1/n,
+  // so a converged problem explores a logarithmic number of times
+  static constexpr std::uint64_t decay_samples = 100;
+
+  std::mutex m_mutex;
+  std::string m_file;
+  double m_epsilon;
+  std::mt19937_64 m_random;
+  std::map<std::size_t, TuningVariable> m_variables;
+  std::map<std::string, Problem> m_problems;
+  std::map<std::size_t, OpenContext> m_contexts;
+
+  // Returns the candidate indices of a configuration, or an empty vector if
+  // it does not fit the current candidates, e.g. when read from the file
+  // of a run with different ones.
+  static std::vector<std::size_t> parse(
+      std::string const& configuration,
+      std::vector<TuningVariable const*> const& variables) {
+    std::vector<std::size_t> choice;
+    std::string component;
+    auto match = [&]() {
+      if (choice.size() >= variables.size()) return false;
+      auto const& texts = variables[choice.size()]->texts;
+      auto const found  = std::find(texts.begin(), texts.end(), component);
+      if (found == texts.end()) return false;
+      choice.push_back(found - texts.begin());
+      component.clear();
+      return true;
+    };
+    for (std::size_t i = 0; i < configuration.size(); ++i) {
+      if (configuration[i] == '\\' && i + 1 < configuration.size()) {
+        component += configuration[i];
+        component += configuration[++i];
+      } else if (configuration[i] == ',') {
+        if (!match()) return {};
+      } else {
+        component += configuration[i];
+      }
+    }
+    if (!match() || choice.size() != variables.size()) return {};
+    return choice;
+  }
+
+  static std::string configuration_text(
+      std::vector<std::size_t> const& choice,
+      std::vector<TuningVariable const*> const& variables) {
+    std::string text;
+    for (std::size_t i = 0; i < choice.size(); ++i) {
+      if (i > 0) text += ',';
+      text += variables[i]->texts[choice[i]];
+    }
+    return text;
+  }
+
+  static void update_best(Problem& problem) {
+    problem.best.clear();
+    double best = std::numeric_limits<double>::max();
+    for (auto const& arm : problem.arms) {
+      if (arm.second.samples > 0 && arm.second.mean < best) {
+        best         = arm.second.mean;
+        problem.best = arm.first;
+      }
+    }
+  }
+
+  std::vector<std::size_t> choose(
+      Problem& problem, std::vector<TuningVariable const*> const& variables) {
+    std::size_t num_configurations = 1;
+    for (auto const* variable : variables) {
+      num_configurations = std::min(
+          num_configurations * variable->candidates.size(), max_enumerated);
+    }
+    std::uniform_real_distribution<double> coin(0., 1.);
+    bool const warmed_up =
+        problem.arms.size() >= std::min(num_configurations, warmup_arms);
+    double const epsilon =
+        m_epsilon * double(decay_samples) /
+        double(std::max<std::uint64_t>(decay_samples, problem.samples));
+    if (warmed_up && coin(m_random) >= epsilon) {
+      auto choice = parse(problem.best, variables);
+      if (!choice.empty()) return choice;
+      // the best known configuration does not fit, fall back to the ones
+      // that do
+      Problem fitting;
+      for (auto const& arm : problem.arms) {
+        if (!parse(arm.first, variables).empty()) fitting.arms.insert(arm);
+      }
+      update_best(fitting);
+      if (!fitting.best.empty()) return parse(fitting.best, variables);
+    }
+    std::vector<std::size_t> choice(variables.size());
+    for (int attempt = 0; attempt < 16; ++attempt) {
+      for (std::size_t i = 0; i < variables.size(); ++i) {
+        choice[i] = std::uniform_int_distribution<std::size_t>(
+            0, variables[i]->candidates.size() - 1)(m_random);
+      }
+      if (problem.arms.count(configuration_text(choice, variables)) == 0) {
+        return choice;
+      }
+    }
+    // in small spaces, look for an unmeasured configuration in order
+    if (num_configurations < max_enumerated) {
+      std::vector<std::size_t> next(variables.size(), 0);
+      for (std::size_t n = 0; n < num_configurations; ++n) {
+        if (problem.arms.count(configuration_text(next, variables)) == 0) {
+          return next;
+        }
+        for (std::size_t i = 0; i < next.size(); ++i) {
+          if (++next[i] < variables[i]->candidates.size()) break;
+          next[i] = 0;
+        }
+      }
+    }
+    return choice;
+  }
+
+  std::string value_text(Kokkos::Tools::Experimental::VariableValue const&
+                             value) const {
+    if (value.metadata != nullptr) {
+      return tuning_value_text(value.metadata->type, value.value);
+    }
+    auto const variable = m_variables.find(value.type_id);
+    return variable == m_variables.end()
+               ? std::string()
+               : tuning_value_text(variable->second.type, value.value);
+  }
+
+  double value_number(
+      Kokkos::Tools::Experimental::VariableValue const& value) const {
+    using Kokkos::Tools::Experimental::ValueType;
+    auto type = ValueType::kokkos_value_double;
+    if (value.metadata != nullptr) {
+      type = value.metadata->type;
+    } else if (m_variables.count(value.type_id) > 0) {
+      type = m_variables.at(value.type_id).type;
+    }
+    return type == ValueType::kokkos_value_int64 ? double(value.value.int_value)
+                                                 : value.value.double_value;
+  }
+
+  void read(std::istream& in) {
+    for (std::string line; std::getline(in, line);) {
+      if (line.empty() || line[0] == '#') continue;
+      std::stringstream fields(line);
+      std::string key, configuration, samples, mean;
+      if (!std::getline(fields, key, '\t') ||
+          !std::getline(fields, configuration, '\t') ||
+          !std::getline(fields, samples, '\t') ||
+          !std::getline(fields, mean, '\t')) {
+        continue;
+      }
+      auto& problem = m_problems[key];
+      auto& arm     = problem.arms[configuration];
+      arm.samples   = std::strtoull(samples.c_str(), nullptr, 10);
+      arm.mean      = std::strtod(mean.c_str(), nullptr);
+      problem.samples += arm.samples;
+      update_best(problem);
+    }
+  }
+
+ public:
+  Autotuner(std::string file, double epsilon)
+      : m_file(std::move(file)), m_epsilon(epsilon) {
+    std::ifstream in(m_file);
+    if (in) read(in);
+  }
+
+  std::string const& file() const { return m_file; }
+
+  void declare(char const* name, std::size_t id,
+               Kokkos::Tools::Experimental::VariableInfo const* info) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_variables.erase(id);
+    m_variables.emplace(id, TuningVariable(name, *info));
+  }
+
+  void begin(std::size_t context) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_contexts[context] = OpenContext();
+  }
+
+  void goal(std::size_t context,
+            Kokkos::Tools::Experimental::OptimizationGoal const& goal) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& open    = m_contexts[context];
+    open.has_goal = true;
+    open.maximize = goal.goal == Kokkos_Tools_Maximize;
+  }
+
+  void request(std::size_t context, std::size_t num_inputs,
+               Kokkos::Tools::Experimental::VariableValue const* inputs,
+               std::size_t num_outputs,
+               Kokkos::Tools::Experimental::VariableValue* outputs) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<TuningVariable const*> variables;
+    // keys use escaped names, so they contain no tabs or line breaks
+    std::string key;
+    for (std::size_t i = 0; i < num_outputs; ++i) {
+      auto const variable = m_variables.find(outputs[i].type_id);
+      if (variable == m_variables.end() ||
+          variable->second.candidates.empty()) {
+        return;
+      }
+      variables.push_back(&variable->second);
+      key += (i > 0 ? ";" : "") + tuner_escape(variable->second.name);
+    }
+    if (variables.empty()) return;
+    std::vector<std::string> input_texts;
+    for (std::size_t i = 0; i < num_inputs; ++i) {
+      auto const variable = m_variables.find(inputs[i].type_id);
+      if (variable == m_variables.end()) continue;
+      input_texts.push_back(tuner_escape(variable->second.name) + "=" +
+                            value_text(inputs[i]));
+    }
+    // the inputs are kept in a set, so their order is arbitrary
+    std::sort(input_texts.begin(), input_texts.end());
+    for (std::size_t i = 0; i < input_texts.size(); ++i) {
+      key += (i == 0 ? " @ " : ";") + input_texts[i];
+    }
+
+    auto const choice = choose(m_problems[key], variables);
+    for (std::size_t i = 0; i < variables.size(); ++i) {
+      outputs[i].value = variables[i]->candidates[choice[i]];
+    }
+    auto& open         = m_contexts[context];
+    open.key           = key;
+    open.configuration = configuration_text(choice, variables);
+  }
+
+  void end(std::size_t context,
+           Kokkos::Tools::Experimental::VariableValue const& goal_value) {
+    auto const end = clock_type::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const open = m_contexts.find(context);
+    if (open == m_contexts.end()) return;
+    if (!open->second.configuration.empty()) {
+      double cost = seconds_since(open->second.start, end);
+      if (open->second.has_goal) {
+        cost = value_number(goal_value);
+        if (open->second.maximize) cost = -cost;
+      }
+      auto& problem = m_problems[open->second.key];
+      auto& arm     = problem.arms[open->second.configuration];
+      ++arm.samples;
+      ++problem.samples;
+      arm.mean += (cost - arm.mean) / arm.samples;
+      update_best(problem);
+    }
+    m_contexts.erase(open);
+  }
+
+  void write_text(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    out << "# Kokkos builtin tuner: problem, configuration, samples and mean "
+           "cost,\n# the time in seconds or the declared optimization goal "
+           "(negated if\n# maximized), separated by tabs. The best "
+           "configuration of a problem comes first.\n";
+    out.precision(17);
+    for (auto const& entry : m_problems) {
+      auto const& problem = entry.second;
+
+      auto write_arm = [&](std::string const& configuration, Arm const& arm) {
+        out << entry.first << '\t' << configuration << '\t' << arm.samples
+            << '\t' << arm.mean << '\n';
+      };
+      auto const best = problem.arms.find(problem.best);
+      if (best != problem.arms.end()) write_arm(best->first, best->second);
+      for (auto const& arm : problem.arms) {
+        if (arm.first != problem.best) write_arm(arm.first, arm.second);
+      }
+    }
+  }
+};
+
+double tuner_epsilon() {
+  char const* env = std::getenv("KOKKOS_TOOLS_BUILTIN_TUNER_EPSILON");
+  if (env != nullptr && *env != '\0') {
+    char* end;
+    double const epsilon = std::strtod(env, &end);
+    if (*end == '\0' && epsilon >= 0. && epsilon <= 1.) return epsilon;
+    std::cerr << "Warning: ignoring invalid "
+                 "KOKKOS_TOOLS_BUILTIN_TUNER_EPSILON='"
+              << env << "'" << std::endl;
+  }
+  return 0.1;
+}
+
+std::string tuner_file() {
+  char const* env = std::getenv("KOKKOS_TOOLS_BUILTIN_TUNER_FILE");
+  if (env != nullptr && *env != '\0') return env;
+  return output_prefix() + ".tuner.txt";
+}
+
+std::unique_ptr<KernelTimer> g_timer;
+std::unique_ptr<Tracer> g_tracer;
+std::unique_ptr<KernelCounters> g_counters;
+std::unique_ptr<MemoryProfiler> g_memory;
+std::unique_ptr<FenceAudit> g_fences;
+std::unique_ptr<Autotuner> g_tuner;
+
+// The callbacks are shared by all builtin tools and forward to the enabled
+// ones. Only the timer uses the kernel ids.
+void builtin_begin_kernel(EventKind kind, char const* name,
+                          std::uint32_t device_id, std::uint64_t* id) {
+  if (g_timer) g_timer->begin_kernel(kind, name, device_id, id);
+  if (g_tracer) g_tracer->begin(kind, name, device_id);
+  if (g_counters) g_counters->begin(name);
+  if (g_fences) g_fences->launch(device_id);
+}
+void builtin_begin_parallel_for(char const* name, std::uint32_t device_id,
+                                std::uint64_t* id) {
+  builtin_begin_kernel(kind_parallel_for, name, device_id, id);
+}
+void builtin_begin_parallel_reduce(char const* name, std::uint32_t device_id,
+                                   std::uint64_t* id) {
+  builtin_begin_kernel(kind_parallel_reduce, name, device_id, id);
+}
+void builtin_begin_parallel_scan(char const* name, std::uint32_t device_id,
+                                 std::uint64_t* id) {
+  builtin_begin_kernel(kind_parallel_scan, name, device_id, id);
+}
+void builtin_thread_work(std::uint32_t num_threads, std::uint64_t const*,
+                         double const* busy_seconds) {
+  if (g_timer) g_timer->thread_work(num_threads, busy_seconds);
+}
+void builtin_kernel_work(std::uint64_t, double bytes, double flops) {
+  g_timer->kernel_work(bytes, flops);
+}
+void builtin_end_kernel(std::uint64_t id) {
+  if (g_counters) g_counters->end();
+  if (g_tracer) g_tracer->end();
+  if (g_timer) g_timer->end_kernel(id);
+}
+void builtin_push_region(char const* name) {
+  if (g_timer) g_timer->push_region(name);
+  if (g_tracer) g_tracer->push_region(name);
+  if (g_memory) g_memory->push_region(name);
+}
+void builtin_pop_region() {
+  if (g_memory) g_memory->pop_region();
+  if (g_tracer) g_tracer->pop_region();
+  if (g_timer) g_timer->pop_region();
+}
+void builtin_allocate_data(Kokkos::Tools::SpaceHandle handle, char const* name,
+                           void const*, std::uint64_t size) {
+  g_memory->allocate(handle, name, size);
+}
+void builtin_deallocate_data(Kokkos::Tools::SpaceHandle handle,
+                             char const* name, void const*,
+                             std::uint64_t size) {
+  g_memory->deallocate(handle, name, size);
+}
+void builtin_begin_fence(char const* name, std::uint32_t device_id,
+                         std::uint64_t* handle) {
+  *handle = 0;
+  if (g_tracer) g_tracer->begin(kind_fence, name, device_id);
+  if (g_fences) g_fences->begin(name, device_id);
+}
+void builtin_end_fence(std::uint64_t) {
+  if (g_fences) g_fences->end();
+  if (g_tracer) g_tracer->end();
+}
+void builtin_begin_deep_copy(Kokkos::Tools::SpaceHandle dst_handle,
+                             char const* dst_name, void const*,
+                             Kokkos::Tools::SpaceHandle src_handle,
+                             char const* src_name, void const*,
+                             std::uint64_t size) {
+  if (g_tracer) {
+    g_tracer->begin_deep_copy(dst_handle, dst_name, src_handle, src_name,
+                              size);
+  }
+  if (g_fences) g_fences->begin_deep_copy();
+}
+void builtin_end_deep_copy() {
+  if (g_fences) g_fences->end_deep_copy();
+  if (g_tracer) g_tracer->end();
+}
+
+void builtin_declare_variable(char const* name, std::size_t id,
+                              Kokkos::Tools::Experimental::VariableInfo* info) {
+  g_tuner->declare(name, id, info);
+}
+void builtin_request_values(
+    std::size_t context, std::size_t num_inputs,
+    Kokkos::Tools::Experimental::VariableValue const* inputs,
+    std::size_t num_outputs,
+    Kokkos::Tools::Experimental::VariableValue* outputs) {
+  g_tuner->request(context, num_inputs, inputs, num_outputs, outputs);
+}
+void builtin_begin_context(std::size_t context) { g_tuner->begin(context); }
+void builtin_end_context(std::size_t context,
+                         Kokkos::Tools::Experimental::VariableValue value) {
+  g_tuner->end(context, value);
+}
+void builtin_declare_optimization_goal(
+    std::size_t context,
+    Kokkos::Tools::Experimental::OptimizationGoal const goal) {
+  g_tuner->goal(context, goal);
+}
+
+// The timer, the counters and the tuner need the global fences to measure
+// asynchronous kernels, while the trace is meant to show how kernels on
+// different instances overlap. The fence audit leaves out the fences this
+// adds around every kernel.
+void builtin_request_tool_settings(
+    std::uint32_t, Kokkos::Tools::Experimental::ToolSettings* settings) {
+  settings->requires_global_fencing = g_timer || g_counters || g_tuner;
+}
+
+template <class Tool>
+void write_output(std::string const& file_name, Tool& tool,
+                  void (Tool::*write)(std::ostream&)) {
+  std::ofstream out(file_name);
+  if (!out) {
+    std::cerr << "Error: Kokkos builtin tools could not open '" << file_name
+              << "' for writing" << std::endl;
+    return;
+  }
+  (tool.*write)(out);
+}
+
+void builtin_tools_finalize() {
+  std::string const prefix = output_prefix();
+  if (g_timer) {
+    write_output(prefix + ".timer.txt", *g_timer, &KernelTimer::write_text);
+    write_output(prefix + ".timer.json", *g_timer, &KernelTimer::write_json);
+    g_timer.reset();
+  }
+  if (g_tracer) {
+    write_output(prefix + ".trace.json", *g_tracer, &Tracer::write_json);
+    g_tracer.reset();
+  }
+  if (g_counters) {
+    write_output(prefix + ".counters.txt", *g_counters,
+                 &KernelCounters::write_text);
+    write_output(prefix + ".counters.json", *g_counters,
+                 &KernelCounters::write_json);
+    g_counters.reset();
+  }
+  if (g_memory) {
+    write_output(prefix + ".memory.txt", *g_memory,
+                 &MemoryProfiler::write_text);
+    write_output(prefix + ".memory.json", *g_memory,
+                 &MemoryProfiler::write_json);
+    g_memory.reset();
+  }
+  if (g_fences) {
+    write_output(prefix + ".fences.txt", *g_fences, &FenceAudit::write_text);
+    write_output(prefix + ".fences.json", *g_fences, &FenceAudit::write_json);
+    g_fences.reset();
+  }
+  if (g_tuner) {
+    write_output(g_tuner->file(), *g_tuner, &Autotuner::write_text);
+    g_tuner.reset();
+  }
+}
+
+}  // namespace
+
+Kokkos::Tools::Impl::InitializationStatus
+Kokkos::Tools::Impl::initialize_builtin_tools(std::string const& tools) {
+  std::vector<std::string> names;
+  std::stringstream ss(tools);
+  for (std::string name; std::getline(ss, name, ',');) {
+    if (name == "timer" || name == "trace" || name == "counters" ||
+        name == "memory" || name == "fences" || name == "tuner") {
+      names.push_back(name);
+    } else if (!name.empty()) {
+      std::cerr << "Error: unknown Kokkos builtin tool '" << name
+                << "' requested. Available builtin tools: timer, trace, "
+                   "counters, memory, fences, tuner"
+                << std::endl;
+      return {InitializationStatus::InitializationResult::failure,
+              "unknown builtin tool " + name};
+    }
+  }
+
+  for (auto const& name : names) {
+    if (name == "timer" && !g_timer) {
+      g_timer = std::make_unique<KernelTimer>();
+    } else if (name == "trace" && !g_tracer) {
+      g_tracer = std::make_unique<Tracer>(trace_buffer_capacity());
+    } else if (name == "counters" && !g_counters) {
+      g_counters = std::make_unique<KernelCounters>();
+    } else if (name == "memory" && !g_memory) {
+      g_memory = std::make_unique<MemoryProfiler>();
+    } else if (name == "fences" && !g_fences) {
+      g_fences = std::make_unique<FenceAudit>();
+    } else if (name == "tuner" && !g_tuner) {
+#ifndef KOKKOS_ENABLE_TUNING
+      std::cerr << "Warning: Kokkos was built without Kokkos_ENABLE_TUNING, "
+                   "the builtin tuner will not receive any requests"
+                << std::endl;
+#endif
+      g_tuner = std::make_unique<Autotuner>(tuner_file(), tuner_epsilon());
+    }
+  }
+
+  using namespace Kokkos::Tools::Experimental;
+  set_begin_parallel_for_callback(builtin_begin_parallel_for);
+  set_begin_parallel_reduce_callback(builtin_begin_parallel_reduce);
+  set_begin_parallel_scan_callback(builtin_begin_parallel_scan);
+  set_end_parallel_for_callback(builtin_end_kernel);
+  set_end_parallel_reduce_callback(builtin_end_kernel);
+  set_end_parallel_scan_callback(builtin_end_kernel);
+  set_push_region_callback(builtin_push_region);
+  set_pop_region_callback(builtin_pop_region);
+  if (g_tracer || g_fences) {
+    set_begin_fence_callback(builtin_begin_fence);
+    set_end_fence_callback(builtin_end_fence);
+    set_begin_deep_copy_callback(builtin_begin_deep_copy);
+    set_end_deep_copy_callback(builtin_end_deep_copy);
+  }
+  if (g_memory) {
+    set_allocate_data_callback(builtin_allocate_data);
+    set_deallocate_data_callback(builtin_deallocate_data);
+  }
+  if (g_timer) {
+    set_thread_work_callback(builtin_thread_work);
+    set_kernel_work_callback(builtin_kernel_work);
+  }
+  if (g_tuner) {
+    set_declare_input_type_callback(builtin_declare_variable);
+    set_declare_output_type_callback(builtin_declare_variable);
+    set_request_output_values_callback(builtin_request_values);
+    set_begin_context_callback(builtin_begin_context);
+    set_end_context_callback(builtin_end_context);
+    set_declare_optimization_goal_callback(builtin_declare_optimization_goal);
+  }
+  set_request_tool_settings_callback(builtin_request_tool_settings);
+  set_finalize_callback(builtin_tools_finalize);
+  return {InitializationStatus::InitializationResult::success, ""};
+}
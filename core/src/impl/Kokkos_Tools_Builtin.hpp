@@ -0,0 +1,89 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_KOKKOS_TOOLS_BUILTIN_HPP
+#define KOKKOS_IMPL_KOKKOS_TOOLS_BUILTIN_HPP
+
+#include <impl/Kokkos_Profiling.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+/**
+ * Tools that are part of Kokkos and do not need to be loaded from a
+ * separate library. They are selected with --kokkos-tools-builtin=LIST or
+ * the KOKKOS_TOOLS_BUILTIN environment variable, where LIST is a comma
+ * separated list of tool names:
+ *
+ * timer: number of calls and min/avg/max/total time per kernel name and per
+ *        profiling region, and for RangePolicy kernels on host backends the
+ *        load imbalance, the busy time of the slowest thread over the mean
+ *        thread. For kernels that declared their bytes and flops with
+ *        Kokkos::Tools::Experimental::ScopedKernelWork, the achieved GB/s and
+ *        GFLOP/s and the percentage of the roofline bound given by the peak
+ *        bandwidth and flop rate of the host, measured at finalize.
+ * trace: timeline of kernels, fences, deep copies and regions per execution
+ *        space instance and host thread in the Chrome trace event format,
+ *        viewable in chrome://tracing or Perfetto. Each thread keeps the
+ *        last KOKKOS_TOOLS_BUILTIN_TRACE_EVENTS events (default 65536).
+ *        Unless the timer is enabled as well, kernels are not fenced, so on
+ *        asynchronous backends they span the launch only.
+ * counters: cycles, instructions, last level cache references and misses
+ *        and task clock per kernel name and thread, read on Linux with
+ *        perf_event_open, and the derived IPC, miss rate and estimated DRAM
+ *        traffic. Counters the system does not provide are reported as
+ *        unavailable.
+ * memory: live and peak bytes per memory space and label, the regions active
+ *        at the peak and the labels that made it up, and the number and rate
+ *        of allocations per label to find temporaries worth pooling
+ * fences: count of the global fences, e.g. the ones in deep_copy or in the
+ *        deallocation of views, per name, execution space type and call
+ *        stack, the time blocked in them and how many found no kernel or
+ *        copy launched since the previous global fence, to find the fences
+ *        worth removing. The fences the timer and counters request are
+ *        listed as well. Call sites are only resolved to function names if
+ *        the executable exports its symbols, e.g. when linked with -rdynamic.
+ * tuner: answers the tuning requests of Kokkos::Tools::Experimental, e.g.
+ *        of make_categorical_tuner or, with --kokkos-tune-internals, of the
+ *        team and tile sizes of kernels and the schedule and chunk size of
+ *        RangePolicy kernels on host backends. Each problem, given by the
+ *        output variables and the values of the input variables such as
+ *        kokkos.kernel_name, is searched epsilon-greedy: the untried
+ *        configurations are measured first, then the one with the lowest
+ *        mean time, or the declared optimization goal, is used and another
+ *        one is tried with the probability KOKKOS_TOOLS_BUILTIN_TUNER_EPSILON
+ *        (default 0.1), which decays once the problem ran 100 times. The
+ *        measurements are read at initialization from and written at
+ *        finalize to KOKKOS_TOOLS_BUILTIN_TUNER_FILE (default
+ *        <prefix>.tuner.txt), so later runs start from the learned choices.
+ *        Requires Kokkos_ENABLE_TUNING.
+ *
+ * The results are written at finalize() to files starting with the prefix
+ * given by the KOKKOS_TOOLS_BUILTIN_OUTPUT environment variable (default
+ * "kokkos-tools-<pid>"), e.g. <prefix>.timer.txt, <prefix>.timer.json,
+ * <prefix>.trace.json, <prefix>.counters.txt, <prefix>.memory.txt,
+ * <prefix>.fences.txt and <prefix>.tuner.txt.
+ */
+InitializationStatus initialize_builtin_tools(std::string const& tools);
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif
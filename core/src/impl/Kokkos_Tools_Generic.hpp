@@ -25,6 +25,9 @@
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Tuners.hpp>
 
+#include <string>
+#include <vector>
+
 namespace Kokkos {
 
 namespace Tools {
@@ -33,25 +36,47 @@ namespace Experimental {
 
 namespace Impl {
 
-static std::map<std::string, Kokkos::Tools::Experimental::TeamSizeTuner>
+using Kokkos::Tools::Impl::InternedKernelName;
+
+// tuners are keyed by the interned id of the kernel name, the ones of range
+// policies also by the length bucket of the range
+template <class Policy>
+uint32_t tuner_key(InternedKernelName const& kernel, const Policy&) {
+  return kernel.id;
+}
+
+template <class... Properties>
+uint64_t tuner_key(InternedKernelName const& kernel,
+                   const Kokkos::RangePolicy<Properties...>& policy) {
+  uint64_t const bucket = Experimental::RangePolicyTuner::length_bucket(policy);
+  return (bucket << 32) | kernel.id;
+}
+
+static std::unordered_map<uint32_t,
+                          Kokkos::Tools::Experimental::TeamSizeTuner>
     team_tuners;
 
+static std::unordered_map<uint64_t,
+                          Kokkos::Tools::Experimental::RangePolicyTuner>
+    range_policy_tuners;
+
 template <int Rank>
 using MDRangeTuningMap =
-    std::map<std::string, Kokkos::Tools::Experimental::MDRangeTuner<Rank>>;
+    std::unordered_map<uint32_t,
+                       Kokkos::Tools::Experimental::MDRangeTuner<Rank>>;
 
 template <int Rank>
 static MDRangeTuningMap<Rank> mdrange_tuners;
 
 // For any policies without a tuning implementation, with a reducer
 template <class ReducerType, class ExecPolicy, class Functor, typename TagType>
-void tune_policy(const size_t, const std::string&, ExecPolicy&, const Functor&,
-                 TagType) {}
+void tune_policy(const size_t, InternedKernelName const&, ExecPolicy&,
+                 const Functor&, TagType) {}
 
 // For any policies without a tuning implementation, without a reducer
 template <class ExecPolicy, class Functor, typename TagType>
-void tune_policy(const size_t, const std::string&, ExecPolicy&, const Functor&,
-                 const TagType&) {}
+void tune_policy(const size_t, InternedKernelName const&, ExecPolicy&,
+                 const Functor&, const TagType&) {}
 
 /**
  * Tuning for parallel_fors and parallel_scans is a fairly simple process.
@@ -166,22 +191,18 @@ struct ComplexReducerSizeCalculator {
 
 template <class Tuner, class Functor, class TagType,
           class TuningPermissionFunctor, class Map, class Policy>
-void generic_tune_policy(const std::string& label_in, Map& map, Policy& policy,
-                         const Functor& functor, const TagType& tag,
+void generic_tune_policy(InternedKernelName const& kernel, Map& map,
+                         Policy& policy, const Functor& functor,
+                         const TagType& tag,
                          const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
-    if (label_in.empty()) {
-      using policy_type = std::remove_reference_t<decltype(policy)>;
-      using work_tag    = typename policy_type::work_tag;
-      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
-      label = name.get();
-    }
     auto tuner_iter = [&]() {
-      auto my_tuner = map.find(label);
+      auto const key = tuner_key(kernel, policy);
+      auto my_tuner  = map.find(key);
       if (my_tuner == map.end()) {
-        return (map.emplace(label, Tuner(label, policy, functor, tag,
-                                         Impl::SimpleTeamSizeCalculator{}))
+        return (map.emplace(key,
+                            Tuner(*kernel.name, policy, functor, tag,
+                                  Impl::SimpleTeamSizeCalculator{}))
                     .first);
       }
       return my_tuner;
@@ -191,23 +212,18 @@ void generic_tune_policy(const std::string& label_in, Map& map, Policy& policy,
 }
 template <class Tuner, class ReducerType, class Functor, class TagType,
           class TuningPermissionFunctor, class Map, class Policy>
-void generic_tune_policy(const std::string& label_in, Map& map, Policy& policy,
-                         const Functor& functor, const TagType& tag,
+void generic_tune_policy(InternedKernelName const& kernel, Map& map,
+                         Policy& policy, const Functor& functor,
+                         const TagType& tag,
                          const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
-    if (label_in.empty()) {
-      using policy_type = std::remove_reference_t<decltype(policy)>;
-      using work_tag    = typename policy_type::work_tag;
-      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
-      label = name.get();
-    }
     auto tuner_iter = [&]() {
-      auto my_tuner = map.find(label);
+      auto const key = tuner_key(kernel, policy);
+      auto my_tuner  = map.find(key);
       if (my_tuner == map.end()) {
         return (map.emplace(
-                       label,
-                       Tuner(label, policy, functor, tag,
+                       key,
+                       Tuner(*kernel.name, policy, functor, tag,
                              Impl::ComplexReducerSizeCalculator<ReducerType>{}))
                     .first);
       }
@@ -219,11 +235,12 @@ void generic_tune_policy(const std::string& label_in, Map& map, Policy& policy,
 
 // tune a TeamPolicy, without reducer
 template <class Functor, class TagType, class... Properties>
-void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+void tune_policy(const size_t /**tuning_context*/,
+                 InternedKernelName const& kernel,
                  Kokkos::TeamPolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   generic_tune_policy<Experimental::TeamSizeTuner>(
-      label_in, team_tuners, policy, functor, tag,
+      kernel, team_tuners, policy, functor, tag,
       [](const Kokkos::TeamPolicy<Properties...>& candidate_policy) {
         return (candidate_policy.impl_auto_team_size() ||
                 candidate_policy.impl_auto_vector_length());
@@ -232,26 +249,63 @@ void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 
 // tune a TeamPolicy, with reducer
 template <class ReducerType, class Functor, class TagType, class... Properties>
-void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+void tune_policy(const size_t /**tuning_context*/,
+                 InternedKernelName const& kernel,
                  Kokkos::TeamPolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   generic_tune_policy<Experimental::TeamSizeTuner, ReducerType>(
-      label_in, team_tuners, policy, functor, tag,
+      kernel, team_tuners, policy, functor, tag,
       [](const Kokkos::TeamPolicy<Properties...>& candidate_policy) {
         return (candidate_policy.impl_auto_team_size() ||
                 candidate_policy.impl_auto_vector_length());
       });
 }
 
+// Whether the schedule and chunk size of a RangePolicy are tuned: only on
+// host backends, for the ones not given by the user and not for scans, whose
+// host implementations always partition statically.
+template <class TagType, class... Properties>
+bool should_tune_range_policy(
+    const Kokkos::RangePolicy<Properties...>& policy) {
+  using Policy = Kokkos::RangePolicy<Properties...>;
+  return Kokkos::SpaceAccessibility<typename Policy::execution_space,
+                                    Kokkos::HostSpace>::accessible &&
+         !std::is_same<TagType, Kokkos::ParallelScanTag>::value &&
+         (policy.impl_auto_chunk_size() || Policy::impl_auto_schedule());
+}
+
+// tune a RangePolicy, without reducer
+template <class Functor, class TagType, class... Properties>
+void tune_policy(const size_t /**tuning_context*/,
+                 InternedKernelName const& kernel,
+                 Kokkos::RangePolicy<Properties...>& policy,
+                 const Functor& functor, const TagType& tag) {
+  generic_tune_policy<Experimental::RangePolicyTuner>(
+      kernel, range_policy_tuners, policy, functor, tag,
+      should_tune_range_policy<TagType, Properties...>);
+}
+
+// tune a RangePolicy, with reducer
+template <class ReducerType, class Functor, class TagType, class... Properties>
+void tune_policy(const size_t /**tuning_context*/,
+                 InternedKernelName const& kernel,
+                 Kokkos::RangePolicy<Properties...>& policy,
+                 const Functor& functor, const TagType& tag) {
+  generic_tune_policy<Experimental::RangePolicyTuner, ReducerType>(
+      kernel, range_policy_tuners, policy, functor, tag,
+      should_tune_range_policy<TagType, Properties...>);
+}
+
 // tune a MDRangePolicy, without reducer
 template <class Functor, class TagType, class... Properties>
-void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+void tune_policy(const size_t /**tuning_context*/,
+                 InternedKernelName const& kernel,
                  Kokkos::MDRangePolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   using Policy              = Kokkos::MDRangePolicy<Properties...>;
   static constexpr int rank = Policy::rank;
   generic_tune_policy<Experimental::MDRangeTuner<rank>>(
-      label_in, mdrange_tuners<rank>, policy, functor, tag,
+      kernel, mdrange_tuners<rank>, policy, functor, tag,
       [](const Policy& candidate_policy) {
         return candidate_policy.impl_tune_tile_size();
       });
@@ -259,13 +313,14 @@ void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 
 // tune a MDRangePolicy, with reducer
 template <class ReducerType, class Functor, class TagType, class... Properties>
-void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+void tune_policy(const size_t /**tuning_context*/,
+                 InternedKernelName const& kernel,
                  Kokkos::MDRangePolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   using Policy              = Kokkos::MDRangePolicy<Properties...>;
   static constexpr int rank = Policy::rank;
   generic_tune_policy<Experimental::MDRangeTuner<rank>, ReducerType>(
-      label_in, mdrange_tuners<rank>, policy, functor, tag,
+      kernel, mdrange_tuners<rank>, policy, functor, tag,
       [](const Policy& candidate_policy) {
         return candidate_policy.impl_tune_tile_size();
       });
@@ -274,11 +329,11 @@ void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 template <class ReducerType>
 struct ReductionSwitcher {
   template <class Functor, class TagType, class ExecPolicy>
-  static void tune(const size_t tuning_context, const std::string& label,
-                   ExecPolicy& policy, const Functor& functor,
-                   const TagType& tag) {
+  static void tune(const size_t tuning_context,
+                   InternedKernelName const& kernel, ExecPolicy& policy,
+                   const Functor& functor, const TagType& tag) {
     if (Kokkos::tune_internals()) {
-      tune_policy<ReducerType>(tuning_context, label, policy, functor, tag);
+      tune_policy<ReducerType>(tuning_context, kernel, policy, functor, tag);
     }
   }
 };
@@ -286,62 +341,66 @@ struct ReductionSwitcher {
 template <>
 struct ReductionSwitcher<Kokkos::InvalidType> {
   template <class Functor, class TagType, class ExecPolicy>
-  static void tune(const size_t tuning_context, const std::string& label,
-                   ExecPolicy& policy, const Functor& functor,
-                   const TagType& tag) {
+  static void tune(const size_t tuning_context,
+                   InternedKernelName const& kernel, ExecPolicy& policy,
+                   const Functor& functor, const TagType& tag) {
     if (Kokkos::tune_internals()) {
-      tune_policy(tuning_context, label, policy, functor, tag);
+      tune_policy(tuning_context, kernel, policy, functor, tag);
     }
   }
 };
 
 template <class Tuner, class Functor, class TagType,
           class TuningPermissionFunctor, class Map, class Policy>
-void generic_report_results(const std::string& label_in, Map& map,
+void generic_report_results(InternedKernelName const& kernel, Map& map,
                             Policy& policy, const Functor&, const TagType&,
                             const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
-    if (label_in.empty()) {
-      using policy_type = std::remove_reference_t<decltype(policy)>;
-      using work_tag    = typename policy_type::work_tag;
-      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
-      label = name.get();
-    }
-    auto tuner_iter = map[label];
-    tuner_iter.end();
+    auto tuner_iter = map.find(tuner_key(kernel, policy));
+    if (tuner_iter != map.end()) tuner_iter->second.end();
   }
 }
 
 // report results for a policy type we don't tune (do nothing)
 template <class ExecPolicy, class Functor, typename TagType>
-void report_policy_results(const size_t, const std::string&, ExecPolicy&,
-                           const Functor&, const TagType&) {}
+void report_policy_results(const size_t, InternedKernelName const&,
+                           ExecPolicy&, const Functor&, const TagType&) {}
 
 // report results for a TeamPolicy
 template <class Functor, class TagType, class... Properties>
 void report_policy_results(const size_t /**tuning_context*/,
-                           const std::string& label_in,
+                           InternedKernelName const& kernel,
                            Kokkos::TeamPolicy<Properties...>& policy,
                            const Functor& functor, const TagType& tag) {
   generic_report_results<Experimental::TeamSizeTuner>(
-      label_in, team_tuners, policy, functor, tag,
+      kernel, team_tuners, policy, functor, tag,
       [](const Kokkos::TeamPolicy<Properties...>& candidate_policy) {
         return (candidate_policy.impl_auto_team_size() ||
                 candidate_policy.impl_auto_vector_length());
       });
 }
 
+// report results for a RangePolicy
+template <class Functor, class TagType, class... Properties>
+void report_policy_results(const size_t /**tuning_context*/,
+                           InternedKernelName const& kernel,
+                           Kokkos::RangePolicy<Properties...>& policy,
+                           const Functor& functor, const TagType& tag) {
+  generic_report_results<Experimental::RangePolicyTuner>(
+      kernel, range_policy_tuners, policy, functor, tag,
+      should_tune_range_policy<TagType, Properties...>);
+}
+
 // report results for an MDRangePolicy
 template <class Functor, class TagType, class... Properties>
 void report_policy_results(const size_t /**tuning_context*/,
-                           const std::string& label_in,
+                           InternedKernelName const& kernel,
                            Kokkos::MDRangePolicy<Properties...>& policy,
                            const Functor& functor, const TagType& tag) {
   using Policy              = Kokkos::MDRangePolicy<Properties...>;
   static constexpr int rank = Policy::rank;
   generic_report_results<Experimental::MDRangeTuner<rank>>(
-      label_in, mdrange_tuners<rank>, policy, functor, tag,
+      kernel, mdrange_tuners<rank>, policy, functor, tag,
       [](const Policy& candidate_policy) {
         return candidate_policy.impl_tune_tile_size();
       });
@@ -353,22 +412,90 @@ void report_policy_results(const size_t /**tuning_context*/,
 
 namespace Impl {
 
+// Returns the interned name of a kernel. Each thread remembers the last few
+// labels launched with a functor type and work tag, so that repeated launches
+// of a kernel neither allocate nor access the shared name registry, also when
+// one functor type is launched under several labels.
+template <class FunctorType, class TagType>
+InternedKernelName get_kernel_name(const std::string& label) {
+  struct Entry {
+    std::string label;
+    InternedKernelName kernel = {0, nullptr};
+  };
+  constexpr int cache_size = 4;
+  static thread_local Entry cache[cache_size];
+  static thread_local int next = 0;
+  for (auto const& entry : cache) {
+    if (entry.kernel.name != nullptr && entry.label == label) {
+      return entry.kernel;
+    }
+  }
+  auto& entry = cache[next];
+  next        = (next + 1) % cache_size;
+  Kokkos::Impl::ParallelConstructName<FunctorType, TagType> name(label);
+  entry.kernel = intern_kernel_name(name.get());
+  entry.label  = label;
+  return entry.kernel;
+}
+
+#ifdef KOKKOS_ENABLE_TUNING
+// Names of the kernels tuned on this thread, from the beginning to the end of
+// their launch, so that the end reports the results without a new look up
+inline std::vector<InternedKernelName>& tuned_kernels() {
+  static thread_local std::vector<InternedKernelName> kernels;
+  return kernels;
+}
+#endif
+
+// Number of iterations of a launch that work declared per iteration with
+// ScopedKernelWork is scaled by, zero for policies without a notion of it.
+template <class ExecPolicy>
+uint64_t policy_iterations(ExecPolicy const&) {
+  return 0;
+}
+
+template <class... Properties>
+uint64_t policy_iterations(Kokkos::RangePolicy<Properties...> const& policy) {
+  return policy.end() - policy.begin();
+}
+
+template <class... Properties>
+uint64_t policy_iterations(Kokkos::MDRangePolicy<Properties...> const& policy) {
+  uint64_t iterations = 1;
+  for (int i = 0; i < Kokkos::MDRangePolicy<Properties...>::rank; ++i) {
+    iterations *= policy.m_upper[i] - policy.m_lower[i];
+  }
+  return iterations;
+}
+
+template <class... Properties>
+uint64_t policy_iterations(Kokkos::TeamPolicy<Properties...> const& policy) {
+  return policy.league_size();
+}
+
 template <class ExecPolicy, class FunctorType>
 void begin_parallel_for(ExecPolicy& policy, FunctorType& functor,
                         const std::string& label, uint64_t& kpID) {
+  InternedKernelName kernel = {0, nullptr};
   if (Kokkos::Tools::profileLibraryLoaded()) {
-    Kokkos::Impl::ParallelConstructName<FunctorType,
-                                        typename ExecPolicy::work_tag>
-        name(label);
-    Kokkos::Tools::beginParallelFor(
-        name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
-        &kpID);
+    kernel = get_kernel_name<FunctorType, typename ExecPolicy::work_tag>(label);
+    if (begin_kernel_sample(kernel.id)) {
+      Kokkos::Tools::beginParallelFor(
+          *kernel.name,
+          Kokkos::Profiling::Experimental::device_id(policy.space()), &kpID);
+      report_kernel_work(kpID, policy_iterations(policy));
+    }
   }
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   if (Kokkos::tune_internals()) {
-    Experimental::Impl::tune_policy(context_id, label, policy, functor,
+    if (kernel.name == nullptr) {
+      kernel =
+          get_kernel_name<FunctorType, typename ExecPolicy::work_tag>(label);
+    }
+    Experimental::Impl::tune_policy(context_id, kernel, policy, functor,
                                     Kokkos::ParallelForTag{});
+    tuned_kernels().push_back(kernel);
   }
 #else
   (void)functor;
@@ -378,38 +505,47 @@ void begin_parallel_for(ExecPolicy& policy, FunctorType& functor,
 template <class ExecPolicy, class FunctorType>
 void end_parallel_for(ExecPolicy& policy, FunctorType& functor,
                       const std::string& label, uint64_t& kpID) {
-  if (Kokkos::Tools::profileLibraryLoaded()) {
+  if (Kokkos::Tools::profileLibraryLoaded() && end_kernel_sample()) {
     Kokkos::Tools::endParallelFor(kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
-  if (Kokkos::tune_internals()) {
+  if (Kokkos::tune_internals() && !tuned_kernels().empty()) {
     Experimental::Impl::report_policy_results(
-        context_id, label, policy, functor, Kokkos::ParallelForTag{});
+        context_id, tuned_kernels().back(), policy, functor,
+        Kokkos::ParallelForTag{});
+    tuned_kernels().pop_back();
   }
 #else
   (void)policy;
   (void)functor;
-  (void)label;
 #endif
+  (void)label;
 }
 
 template <class ExecPolicy, class FunctorType>
 void begin_parallel_scan(ExecPolicy& policy, FunctorType& functor,
                          const std::string& label, uint64_t& kpID) {
+  InternedKernelName kernel = {0, nullptr};
   if (Kokkos::Tools::profileLibraryLoaded()) {
-    Kokkos::Impl::ParallelConstructName<FunctorType,
-                                        typename ExecPolicy::work_tag>
-        name(label);
-    Kokkos::Tools::beginParallelScan(
-        name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
-        &kpID);
+    kernel = get_kernel_name<FunctorType, typename ExecPolicy::work_tag>(label);
+    if (begin_kernel_sample(kernel.id)) {
+      Kokkos::Tools::beginParallelScan(
+          *kernel.name,
+          Kokkos::Profiling::Experimental::device_id(policy.space()), &kpID);
+      report_kernel_work(kpID, policy_iterations(policy));
+    }
   }
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   if (Kokkos::tune_internals()) {
-    Experimental::Impl::tune_policy(context_id, label, policy, functor,
+    if (kernel.name == nullptr) {
+      kernel =
+          get_kernel_name<FunctorType, typename ExecPolicy::work_tag>(label);
+    }
+    Experimental::Impl::tune_policy(context_id, kernel, policy, functor,
                                     Kokkos::ParallelScanTag{});
+    tuned_kernels().push_back(kernel);
   }
 #else
   (void)functor;
@@ -419,37 +555,48 @@ void begin_parallel_scan(ExecPolicy& policy, FunctorType& functor,
 template <class ExecPolicy, class FunctorType>
 void end_parallel_scan(ExecPolicy& policy, FunctorType& functor,
                        const std::string& label, uint64_t& kpID) {
-  if (Kokkos::Tools::profileLibraryLoaded()) {
+  if (Kokkos::Tools::profileLibraryLoaded() && end_kernel_sample()) {
     Kokkos::Tools::endParallelScan(kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
-  if (Kokkos::tune_internals()) {
+  if (Kokkos::tune_internals() && !tuned_kernels().empty()) {
     Experimental::Impl::report_policy_results(
-        context_id, label, policy, functor, Kokkos::ParallelScanTag{});
+        context_id, tuned_kernels().back(), policy, functor,
+        Kokkos::ParallelScanTag{});
+    tuned_kernels().pop_back();
   }
 #else
   (void)policy;
   (void)functor;
-  (void)label;
 #endif
+  (void)label;
 }
 
 template <class ReducerType, class ExecPolicy, class FunctorType>
 void begin_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
                            const std::string& label, uint64_t& kpID) {
+  InternedKernelName kernel = {0, nullptr};
   if (Kokkos::Tools::profileLibraryLoaded()) {
-    Kokkos::Impl::ParallelConstructName<FunctorType,
-                                        typename ExecPolicy::work_tag>
-        name(label);
-    Kokkos::Tools::beginParallelReduce(
-        name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
-        &kpID);
+    kernel = get_kernel_name<FunctorType, typename ExecPolicy::work_tag>(label);
+    if (begin_kernel_sample(kernel.id)) {
+      Kokkos::Tools::beginParallelReduce(
+          *kernel.name,
+          Kokkos::Profiling::Experimental::device_id(policy.space()), &kpID);
+      report_kernel_work(kpID, policy_iterations(policy));
+    }
   }
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
-  Experimental::Impl::ReductionSwitcher<ReducerType>::tune(
-      context_id, label, policy, functor, Kokkos::ParallelReduceTag{});
+  if (Kokkos::tune_internals()) {
+    if (kernel.name == nullptr) {
+      kernel =
+          get_kernel_name<FunctorType, typename ExecPolicy::work_tag>(label);
+    }
+    Experimental::Impl::ReductionSwitcher<ReducerType>::tune(
+        context_id, kernel, policy, functor, Kokkos::ParallelReduceTag{});
+    tuned_kernels().push_back(kernel);
+  }
 #else
   (void)functor;
 #endif
@@ -458,20 +605,22 @@ void begin_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
 template <class ReducerType, class ExecPolicy, class FunctorType>
 void end_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
                          const std::string& label, uint64_t& kpID) {
-  if (Kokkos::Tools::profileLibraryLoaded()) {
+  if (Kokkos::Tools::profileLibraryLoaded() && end_kernel_sample()) {
     Kokkos::Tools::endParallelReduce(kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
-  if (Kokkos::tune_internals()) {
+  if (Kokkos::tune_internals() && !tuned_kernels().empty()) {
     Experimental::Impl::report_policy_results(
-        context_id, label, policy, functor, Kokkos::ParallelReduceTag{});
+        context_id, tuned_kernels().back(), policy, functor,
+        Kokkos::ParallelReduceTag{});
+    tuned_kernels().pop_back();
   }
 #else
   (void)policy;
   (void)functor;
-  (void)label;
 #endif
+  (void)label;
 }
 
 }  // end namespace Impl
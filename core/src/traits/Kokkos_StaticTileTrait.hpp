@@ -0,0 +1,71 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_KOKKOS_STATICTILETRAIT_HPP
+#define KOKKOS_KOKKOS_STATICTILETRAIT_HPP
+
+#include <traits/Kokkos_PolicyTraitAdaptor.hpp>  // TraitSpecificationBase
+#include <Kokkos_Rank.hpp>                       // StaticTile
+#include <type_traits>                           // is_void
+
+namespace Kokkos {
+namespace Impl {
+
+//==============================================================================
+// <editor-fold desc="trait specification"> {{{1
+
+template <class T>
+struct show_extra_static_tile_erroneously_given_to_execution_policy;
+template <>
+struct show_extra_static_tile_erroneously_given_to_execution_policy<void> {};
+struct StaticTileTrait : TraitSpecificationBase<StaticTileTrait> {
+  struct base_traits {
+    using static_tile = void;
+    KOKKOS_IMPL_MSVC_NVCC_EBO_WORKAROUND
+  };
+  template <class StaticTile, class AnalyzeNextTrait>
+  struct mixin_matching_trait : AnalyzeNextTrait {
+    using base_t = AnalyzeNextTrait;
+    using base_t::base_t;
+    static constexpr auto show_static_tile_error_in_compilation_message =
+        show_extra_static_tile_erroneously_given_to_execution_policy<
+            typename base_t::static_tile>{};
+    static_assert(std::is_void<typename base_t::static_tile>::value,
+                  "Kokkos Error: More than one static tile given. Search "
+                  "compiler output for 'show_extra_static_tile' to see the "
+                  "type of the errant tag.");
+    using static_tile = StaticTile;
+  };
+};
+
+// </editor-fold> end trait specification }}}1
+//==============================================================================
+
+//==============================================================================
+// <editor-fold desc="PolicyTraitMatcher specialization"> {{{1
+
+template <unsigned... Extents>
+struct PolicyTraitMatcher<StaticTileTrait,
+                          Kokkos::Experimental::StaticTile<Extents...>>
+    : std::true_type {};
+
+// </editor-fold> end  }}}1
+//==============================================================================
+
+}  // end namespace Impl
+}  // end namespace Kokkos
+
+#endif  // KOKKOS_KOKKOS_STATICTILETRAIT_HPP
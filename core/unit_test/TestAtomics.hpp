@@ -542,6 +542,139 @@ TEST(TEST_CATEGORY, atomics) {
 #endif
 }
 
+// exchange and compare_exchange on 16-byte values must never observe a torn
+// value, neither through the lock-free nor through the lock-based path
+struct Complex16ByteUseCase {
+  using value_type = Kokkos::complex<double>;
+
+  Kokkos::View<value_type, TEST_EXECSPACE> exchanged_{"exchanged"};
+  Kokkos::View<value_type, TEST_EXECSPACE> counter_{"counter"};
+  Kokkos::View<double, TEST_EXECSPACE> sum_{"sum"};
+  Kokkos::View<int, TEST_EXECSPACE> torn_{"torn"};
+  static constexpr int n = 1000;
+
+  KOKKOS_FUNCTION void operator()(int i) const {
+    value_type const old =
+        Kokkos::atomic_exchange(&exchanged_(), value_type(i + 1, -(i + 1)));
+    if (old.imag() != -old.real()) Kokkos::atomic_inc(&torn_());
+    Kokkos::atomic_add(&sum_(), old.real());
+
+    value_type current = Kokkos::atomic_load(&counter_());
+    while (true) {
+      value_type const previous = Kokkos::atomic_compare_exchange(
+          &counter_(), current, current + value_type(1, -1));
+      if (previous == current) break;
+      current = previous;
+    }
+  }
+
+  Complex16ByteUseCase() {
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), *this);
+  }
+
+  void check() {
+    value_type exchanged;
+    value_type counter;
+    double sum;
+    int torn;
+    Kokkos::deep_copy(exchanged, exchanged_);
+    Kokkos::deep_copy(counter, counter_);
+    Kokkos::deep_copy(sum, sum_);
+    Kokkos::deep_copy(torn, torn_);
+    // every written value is either returned by a later exchange or remains
+    ASSERT_EQ(sum + exchanged.real(), 0.5 * n * (n + 1));
+    ASSERT_EQ(exchanged.imag(), -exchanged.real());
+    ASSERT_EQ(torn, 0);
+    ASSERT_EQ(counter, value_type(n, -n));
+  }
+};
+
+TEST(TEST_CATEGORY, atomics_complex_double_exchange) {
+#ifdef DESUL_IMPL_HAVE_HOST_16BYTE_COMPARE_AND_SWAP
+  static_assert(desul::Impl::host_atomic_always_lock_free<
+                Kokkos::complex<double>>());
+#endif
+  Complex16ByteUseCase().check();
+}
+
+// more bins than the accumulator capacity exercises the eviction
+template <class T>
+struct AccumulatorHistogram {
+  Kokkos::View<T*, TEST_EXECSPACE> bins_{"bins", 5};
+  static constexpr int chunks     = 100;
+  static constexpr int chunk_size = 37;
+
+  KOKKOS_FUNCTION void operator()(int chunk) const {
+    Kokkos::Experimental::AtomicAccumulator<T, 3> acc;
+    for (int i = chunk * chunk_size; i < (chunk + 1) * chunk_size; ++i) {
+      acc.add(&bins_(i % 5), T(1));
+      if (i % 11 == 0) acc.flush();
+    }
+  }
+
+  AccumulatorHistogram() {
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(0, chunks),
+                         *this);
+  }
+
+  void check() {
+    auto bins = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bins_);
+    for (int bin = 0; bin < 5; ++bin) {
+      int expected = 0;
+      for (int i = 0; i < chunks * chunk_size; ++i) expected += i % 5 == bin;
+      ASSERT_EQ(bins(bin), T(expected));
+    }
+  }
+};
+
+TEST(TEST_CATEGORY, atomic_accumulator) {
+  AccumulatorHistogram<int>().check();
+  AccumulatorHistogram<double>().check();
+  AccumulatorHistogram<Kokkos::complex<double>>().check();
+}
+
+// the per thread buffers must be flushed by the end of each kernel, whatever
+// its schedule, and outside of range kernels the updates are atomic_adds
+template <class T>
+struct AccumulatedAtomicHistogram {
+  Kokkos::View<T*, TEST_EXECSPACE> bins_{"bins", 5};
+  static constexpr int n = 3700;
+
+  KOKKOS_FUNCTION void operator()(int i) const {
+    Kokkos::Experimental::accumulated_atomic_add<3>(&bins_(i % 5), T(1));
+  }
+
+  // every i adds one to each bin
+  KOKKOS_FUNCTION void operator()(int i, int j) const {
+    Kokkos::Experimental::accumulated_atomic_add(&bins_((i + j) % 5), T(1));
+  }
+
+  template <class Schedule>
+  void check() {
+    for (int repeat = 1; repeat <= 3; ++repeat) {
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<TEST_EXECSPACE, Schedule>(0, n), *this);
+      check_bins(repeat * n / 5);
+    }
+    Kokkos::parallel_for(
+        Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<2>>({0, 0}, {n, 5}),
+        *this);
+    check_bins(3 * n / 5 + n);
+  }
+
+  void check_bins(int expected) {
+    auto bins = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bins_);
+    for (int bin = 0; bin < 5; ++bin) ASSERT_EQ(bins(bin), T(expected));
+  }
+};
+
+TEST(TEST_CATEGORY, accumulated_atomic_add) {
+  AccumulatedAtomicHistogram<int>().check<Kokkos::Schedule<Kokkos::Static>>();
+  AccumulatedAtomicHistogram<int>().check<Kokkos::Schedule<Kokkos::Dynamic>>();
+  AccumulatedAtomicHistogram<double>()
+      .check<Kokkos::Schedule<Kokkos::Dynamic>>();
+}
+
 // see https://github.com/trilinos/Trilinos/pull/11506
 struct TpetraUseCase {
   template <class Scalar>
@@ -16,6 +16,13 @@
 
 #ifndef TESTHALFCONVERSION_HPP_
 #define TESTHALFCONVERSION_HPP_
+
+#include <impl/Kokkos_Half_BulkConversion.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 namespace Test {
 
 template <class T>
@@ -88,6 +95,149 @@ void test_bhalf_conversion() {
   test_bhalf_conversion_type<unsigned long long>();
 }
 
+// decodes an IEEE binary16 bit pattern without using the code under test
+double half_bits_reference(std::uint16_t h) {
+  int const exponent = (h >> 10) & 0x1f;
+  int const mantissa = h & 0x3ff;
+  double const sign  = (h & 0x8000) ? -1.0 : 1.0;
+  if (exponent == 0) return sign * std::ldexp(double(mantissa), -24);
+  if (exponent == 31) return sign * std::numeric_limits<double>::infinity();
+  return sign * std::ldexp(double(1024 + mantissa), exponent - 25);
+}
+
+void test_half_bulk_conversion() {
+  // zeros, one, the largest value, subnormals, the smallest normal, infinities
+  // and an inexact value, repeated to cover both the vector loops and the
+  // remainder
+  std::uint16_t const patterns[] = {0x0000, 0x8000, 0x3c00, 0xc000,
+                                    0x7bff, 0x0001, 0x03ff, 0x0400,
+                                    0x7c00, 0xfc00, 0x3555};
+  constexpr std::size_t n        = 37;
+  std::uint16_t bits[n];
+  for (std::size_t i = 0; i < n; ++i) bits[i] = patterns[i % 11];
+
+  float widened[n];
+  double widened_double[n];
+  std::uint16_t narrowed[n];
+  Kokkos::Impl::convert_half_to_float(bits, widened, n);
+  Kokkos::Impl::convert_half_to_double(bits, widened_double, n);
+  Kokkos::Impl::convert_float_to_half(widened, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(double(widened[i]), half_bits_reference(bits[i]));
+    ASSERT_EQ(widened_double[i], half_bits_reference(bits[i]));
+    ASSERT_EQ(narrowed[i], bits[i]);
+  }
+
+  // ties round to even, including into the subnormals and to infinity
+  float const ties[] = {1.0f + std::ldexp(1.0f, -11),
+                        1.0f + 3.0f * std::ldexp(1.0f, -11), 65520.0f,
+                        std::ldexp(1.0f, -25), 3.0f * std::ldexp(1.0f, -25)};
+  std::uint16_t const rounded[] = {0x3c00, 0x3c02, 0x7c00, 0x0000, 0x0002};
+  float values[n];
+  for (std::size_t i = 0; i < n; ++i) values[i] = ties[i % 5];
+  Kokkos::Impl::convert_float_to_half(values, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) ASSERT_EQ(narrowed[i], rounded[i % 5]);
+
+  // doubles round directly, a value just above a tie rounds up where rounding
+  // through float would see the tie
+  Kokkos::Impl::convert_double_to_half(widened_double, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) ASSERT_EQ(narrowed[i], bits[i]);
+  double const doubles[] = {1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40),
+                            1.0 + std::ldexp(1.0, -11) - std::ldexp(1.0, -40),
+                            1.0 + std::ldexp(1.0, -11), 65520.0, 1e300,
+                            std::ldexp(1.0, -25) + std::ldexp(1.0, -60)};
+  std::uint16_t const doubles_rounded[] = {0x3c01, 0x3c00, 0x3c00,
+                                           0x7c00, 0x7c00, 0x0001};
+  double double_values[n];
+  for (std::size_t i = 0; i < n; ++i) double_values[i] = doubles[i % 6];
+  Kokkos::Impl::convert_double_to_half(double_values, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(narrowed[i], doubles_rounded[i % 6]) << "at " << i;
+  }
+}
+
+void test_bhalf_bulk_conversion() {
+  std::uint16_t const patterns[] = {0x0000, 0x8000, 0x3f80, 0xc000,
+                                    0x7f7f, 0x0001, 0x7f80, 0xff80};
+  constexpr std::size_t n        = 37;
+  std::uint16_t bits[n];
+  for (std::size_t i = 0; i < n; ++i) bits[i] = patterns[i % 8];
+
+  float widened[n];
+  double widened_double[n];
+  std::uint16_t narrowed[n];
+  Kokkos::Impl::convert_bhalf_to_float(bits, widened, n);
+  Kokkos::Impl::convert_bhalf_to_double(bits, widened_double, n);
+  Kokkos::Impl::convert_float_to_bhalf(widened, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(Kokkos::bit_cast<std::uint32_t>(widened[i]),
+              std::uint32_t(bits[i]) << 16);
+    ASSERT_EQ(widened_double[i], double(widened[i]));
+    ASSERT_EQ(narrowed[i], bits[i]);
+  }
+
+  // ties round to even and NaN does not turn into infinity
+  float const ties[] = {1.0f + std::ldexp(1.0f, -8),
+                        1.0f + 3.0f * std::ldexp(1.0f, -8),
+                        Kokkos::bit_cast<float>(0x7f800001u)};
+  std::uint16_t const rounded[] = {0x3f80, 0x3f82, 0x7fc0};
+  float values[n];
+  for (std::size_t i = 0; i < n; ++i) values[i] = ties[i % 3];
+  Kokkos::Impl::convert_float_to_bhalf(values, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) ASSERT_EQ(narrowed[i], rounded[i % 3]);
+
+  Kokkos::Impl::convert_double_to_bhalf(widened_double, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) ASSERT_EQ(narrowed[i], bits[i]);
+  double const doubles[] = {1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -40),
+                            1.0 + std::ldexp(1.0, -8) - std::ldexp(1.0, -40),
+                            1.0 + std::ldexp(1.0, -8), 1e300,
+                            std::numeric_limits<double>::quiet_NaN()};
+  std::uint16_t const doubles_rounded[] = {0x3f81, 0x3f80, 0x3f80, 0x7f80,
+                                           0x7fc0};
+  double double_values[n];
+  for (std::size_t i = 0; i < n; ++i) double_values[i] = doubles[i % 5];
+  Kokkos::Impl::convert_double_to_bhalf(double_values, narrowed, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(narrowed[i], doubles_rounded[i % 5]) << "at " << i;
+  }
+}
+
+template <class HalfType>
+void test_half_deep_copy() {
+  int const n = 1000;
+  Kokkos::View<float*, Kokkos::HostSpace> source("source", n);
+  Kokkos::View<HalfType*, Kokkos::HostSpace> narrow("narrow", n);
+  Kokkos::View<float*, Kokkos::HostSpace> wide("wide", n);
+  Kokkos::View<double*, Kokkos::HostSpace> wide_double("wide_double", n);
+  // small integers and their halves are exact in both 16-bit formats
+  for (int i = 0; i < n; ++i) source(i) = float(i % 200 - 100) * 0.5f;
+  Kokkos::deep_copy(narrow, source);
+  Kokkos::deep_copy(wide, narrow);
+  Kokkos::deep_copy(wide_double, narrow);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(wide(i), source(i));
+    ASSERT_EQ(wide_double(i), double(source(i)));
+  }
+
+  // the same through an execution space instance, and from double
+  Kokkos::View<HalfType*, Kokkos::HostSpace> narrow_double("narrow_double", n);
+  Kokkos::DefaultHostExecutionSpace space;
+  Kokkos::deep_copy(space, narrow_double, wide_double);
+  Kokkos::deep_copy(space, wide, narrow_double);
+  space.fence();
+  for (int i = 0; i < n; ++i) ASSERT_EQ(wide(i), source(i));
+}
+
+TEST(TEST_CATEGORY, half_bulk_conversion) {
+  test_half_bulk_conversion();
+  test_half_deep_copy<Kokkos::Experimental::half_t>();
+}
+
+TEST(TEST_CATEGORY, bhalf_bulk_conversion) {
+  test_bhalf_bulk_conversion();
+  test_half_deep_copy<Kokkos::Experimental::bhalf_t>();
+}
+
 TEST(TEST_CATEGORY, half_conversion) { test_half_conversion(); }
 
 TEST(TEST_CATEGORY, bhalf_conversion) { test_bhalf_conversion(); }
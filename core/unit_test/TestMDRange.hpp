@@ -3831,6 +3831,148 @@ struct TestMDRange_6D_NegIdx {
   }
 };
 
+template <typename ExecSpace>
+struct TestMDRange_TileOrder {
+  using value_type = int;
+
+  using ViewType = typename Kokkos::View<int ***, ExecSpace>;
+
+  ViewType input_view;
+
+  TestMDRange_TileOrder(const int N0, const int N1, const int N2)
+      : input_view("input_view", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    input_view(i, j, k) += 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k,
+                  value_type &lerrors) const {
+    lerrors += input_view(i, j, k) != 1;
+  }
+
+  template <Kokkos::Iterate Outer>
+  static void test_tile_order(const int N0, const int N1, const int N2,
+                              Kokkos::Experimental::TileOrder order) {
+    using range_type =
+        typename Kokkos::MDRangePolicy<ExecSpace,
+                                       Kokkos::Rank<3, Outer, Outer>,
+                                       Kokkos::IndexType<int>>;
+    using tile_type  = typename range_type::tile_type;
+    using point_type = typename range_type::point_type;
+
+    range_type range(point_type{{0, 0, 0}}, point_type{{N0, N1, N2}},
+                     tile_type{{3, 4, 5}});
+    range.set_tile_order(order);
+    ASSERT_EQ(range.tile_order(), order);
+
+    TestMDRange_TileOrder functor(N0, N1, N2);
+    parallel_for(range, functor);
+    int errors = -1;
+    parallel_reduce(range, functor, errors);
+    ASSERT_EQ(errors, 0);
+  }
+
+  // Every tile of the grid is visited once and, on power-of-two grids,
+  // consecutive tiles along the Hilbert curve are neighbours.
+  static void test_curve_coordinates() {
+    using point_type = Kokkos::Array<std::int64_t, 3>;
+    for (auto order : {Kokkos::Experimental::TileOrder::Morton,
+                       Kokkos::Experimental::TileOrder::Hilbert}) {
+      for (auto const &tile_end : {point_type{{8, 8, 8}}, point_type{{5, 1, 7}},
+                                   point_type{{3, 9, 2}}}) {
+        const int num_tiles = tile_end[0] * tile_end[1] * tile_end[2];
+        std::vector<int> visits(num_tiles, 0);
+        point_type previous{};
+        for (int tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+          point_type tile;
+          Kokkos::Impl::tile_curve_coordinates<3, false>(order, tile_idx,
+                                                         tile_end, tile);
+          for (int i = 0; i < 3; ++i) {
+            ASSERT_GE(tile[i], 0);
+            ASSERT_LT(tile[i], tile_end[i]);
+          }
+          ++visits[(tile[0] * tile_end[1] + tile[1]) * tile_end[2] + tile[2]];
+          const bool cube = tile_end[0] == 8;
+          if (order == Kokkos::Experimental::TileOrder::Hilbert && cube &&
+              tile_idx > 0) {
+            std::int64_t distance = 0;
+            for (int i = 0; i < 3; ++i) {
+              distance += std::abs(tile[i] - previous[i]);
+            }
+            ASSERT_EQ(distance, 1);
+          }
+          previous = tile;
+        }
+        for (int tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+          ASSERT_EQ(visits[tile_idx], 1);
+        }
+      }
+    }
+  }
+};
+
+template <typename ExecSpace>
+struct TestMDRange_StaticTile {
+  using value_type = int;
+
+  using ViewType = typename Kokkos::View<int ***, ExecSpace>;
+
+  ViewType input_view;
+
+  struct OffsetTag {};
+
+  TestMDRange_StaticTile(const int N0, const int N1, const int N2)
+      : input_view("input_view", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    input_view(i, j, k) += 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const OffsetTag, const int i, const int j,
+                  const int k) const {
+    input_view(i, j, k) += i + j + k;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k,
+                  value_type &lerrors) const {
+    lerrors += input_view(i, j, k) != 1 + i + j + k;
+  }
+
+  // The extents are no multiples of the tile so both the full tiles and the
+  // partial ones are run
+  template <Kokkos::Iterate Iter>
+  static void test_static_tile(const int N0, const int N1, const int N2) {
+    using StaticTile = Kokkos::Experimental::StaticTile<3, 2, 8>;
+    using range_type =
+        typename Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<3, Iter, Iter>,
+                                       StaticTile, Kokkos::IndexType<int>>;
+    using tagged_range_type =
+        typename Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<3, Iter, Iter>,
+                                       StaticTile, OffsetTag>;
+    using point_type = typename range_type::point_type;
+
+    range_type range(point_type{{0, 0, 0}}, point_type{{N0, N1, N2}});
+    ASSERT_EQ(range.m_tile[0], 3);
+    ASSERT_EQ(range.m_tile[1], 2);
+    ASSERT_EQ(range.m_tile[2], 8);
+    ASSERT_FALSE(range.impl_tune_tile_size());
+
+    TestMDRange_StaticTile functor(N0, N1, N2);
+    parallel_for(range, functor);
+    parallel_for(tagged_range_type({0, 0, 0}, {N0, N1, N2}, {3, 2, 8}),
+                 functor);
+    int errors = -1;
+    parallel_reduce(range, functor, errors);
+    ASSERT_EQ(errors, 0);
+  }
+};
+
 template <typename ExecSpace>
 struct TestMDRange_ReduceScalar {
   struct Scalar {
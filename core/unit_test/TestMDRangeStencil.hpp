@@ -0,0 +1,179 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace {
+
+using StencilSpace = typename TEST_EXECSPACE::memory_space;
+
+// 7 point Jacobi sweep, time step t is stored in u[t % 2]
+struct Jacobi3D {
+  static constexpr int radius = 1;
+
+  using view_type = Kokkos::View<double***, StencilSpace>;
+
+  view_type u[2];
+
+  void operator()(const int step, const int i, const int j, const int k) const {
+    const auto& src = u[step % 2];
+    const auto& dst = u[(step + 1) % 2];
+    if (i == 0 || j == 0 || k == 0 || i == int(src.extent(0)) - 1 ||
+        j == int(src.extent(1)) - 1 || k == int(src.extent(2)) - 1) {
+      dst(i, j, k) = src(i, j, k);
+      return;
+    }
+    dst(i, j, k) = (src(i, j, k) + src(i - 1, j, k) + src(i + 1, j, k) +
+                    src(i, j - 1, k) + src(i, j + 1, k) + src(i, j, k - 1) +
+                    src(i, j, k + 1)) /
+                   7;
+  }
+};
+
+// 9 point cross of radius 2 with integer weights, so that results are exact
+struct Cross2D {
+  struct Tag {};
+  static constexpr int radius = 2;
+
+  using view_type = Kokkos::View<int64_t**, StencilSpace>;
+
+  view_type u[2];
+
+  void operator()(Tag, const int step, const int i, const int j) const {
+    const auto& src = u[step % 2];
+    const auto& dst = u[(step + 1) % 2];
+    const int n0    = src.extent(0);
+    const int n1    = src.extent(1);
+    int64_t sum     = 2 * src(i, j);
+    for (int r = 1; r <= radius; ++r) {
+      if (i - r >= 0) sum += src(i - r, j);
+      if (i + r < n0) sum += src(i + r, j);
+      if (j - r >= 0) sum += src(i, j - r);
+      if (j + r < n1) sum += src(i, j + r);
+    }
+    dst(i, j) = sum % 1000003;
+  }
+};
+
+template <class View>
+void stencil_fill(const View& u) {
+  auto data = u.data();
+  for (size_t i = 0; i < u.span(); ++i) data[i] = (i * 7919) % 101;
+}
+
+template <class View>
+void stencil_check(const View& result, const View& expected) {
+  auto data          = result.data();
+  auto expected_data = expected.data();
+  for (size_t i = 0; i < result.span(); ++i) {
+    ASSERT_EQ(data[i], expected_data[i]) << "at " << i;
+  }
+}
+
+// steps_per_block of zero runs the default blocking
+template <Kokkos::Iterate Outer>
+void test_stencil_jacobi(const int num_steps, const int steps_per_block) {
+  const int n0 = 23, n1 = 17, n2 = 13;
+  Jacobi3D functor, expected;
+  for (int b = 0; b < 2; ++b) {
+    functor.u[b]  = Jacobi3D::view_type("u", n0, n1, n2);
+    expected.u[b] = Jacobi3D::view_type("expected", n0, n1, n2);
+    stencil_fill(functor.u[b]);
+    stencil_fill(expected.u[b]);
+  }
+
+  using policy_type =
+      Kokkos::MDRangePolicy<TEST_EXECSPACE,
+                            Kokkos::Rank<3, Outer, Kokkos::Iterate::Default>>;
+  const policy_type policy({0, 0, 0}, {n0, n1, n2}, {3, 4, 4});
+  if (steps_per_block == 0) {
+    Kokkos::Experimental::parallel_stencil("Test::Stencil::Jacobi3D", policy,
+                                           num_steps, functor);
+  } else {
+    Kokkos::Experimental::parallel_stencil("Test::Stencil::Jacobi3D", policy,
+                                           num_steps, steps_per_block,
+                                           functor);
+  }
+  Kokkos::fence();
+
+  // one sweep over the whole grid per time step
+  for (int step = 0; step < num_steps; ++step) {
+    for (int i = 0; i < n0; ++i) {
+      for (int j = 0; j < n1; ++j) {
+        for (int k = 0; k < n2; ++k) expected(step, i, j, k);
+      }
+    }
+  }
+
+  for (int b = 0; b < 2; ++b) stencil_check(functor.u[b], expected.u[b]);
+}
+
+template <Kokkos::Iterate Outer>
+void test_stencil_cross(const int num_steps, const int steps_per_block) {
+  const int n0 = 41, n1 = 29;
+  Cross2D functor, expected;
+  for (int b = 0; b < 2; ++b) {
+    functor.u[b]  = Cross2D::view_type("u", n0, n1);
+    expected.u[b] = Cross2D::view_type("expected", n0, n1);
+    stencil_fill(functor.u[b]);
+    stencil_fill(expected.u[b]);
+  }
+
+  using policy_type =
+      Kokkos::MDRangePolicy<TEST_EXECSPACE, Cross2D::Tag,
+                            Kokkos::Rank<2, Outer, Kokkos::Iterate::Default>>;
+  const policy_type policy({0, 0}, {n0, n1}, {5, 5});
+  if (steps_per_block == 0) {
+    Kokkos::Experimental::parallel_stencil("Test::Stencil::Cross2D", policy,
+                                           num_steps, functor);
+  } else {
+    Kokkos::Experimental::parallel_stencil("Test::Stencil::Cross2D", policy,
+                                           num_steps, steps_per_block,
+                                           functor);
+  }
+  Kokkos::fence();
+
+  for (int step = 0; step < num_steps; ++step) {
+    for (int i = 0; i < n0; ++i) {
+      for (int j = 0; j < n1; ++j) expected(Cross2D::Tag(), step, i, j);
+    }
+  }
+
+  for (int b = 0; b < 2; ++b) stencil_check(functor.u[b], expected.u[b]);
+}
+
+TEST(TEST_CATEGORY, mdrange_parallel_stencil) {
+  if constexpr (Kokkos::SpaceAccessibility<TEST_EXECSPACE,
+                                           Kokkos::HostSpace>::accessible) {
+    // the slabs are 3 and 4 wide for radius 1, and 5 wide for radius 2
+    for (int num_steps : {0, 1, 2, 5, 12}) {
+      for (int steps_per_block : {0, 1, 2}) {
+        test_stencil_jacobi<Kokkos::Iterate::Right>(num_steps, steps_per_block);
+        test_stencil_jacobi<Kokkos::Iterate::Left>(num_steps, steps_per_block);
+        test_stencil_cross<Kokkos::Iterate::Right>(num_steps, steps_per_block);
+        test_stencil_cross<Kokkos::Iterate::Left>(num_steps, steps_per_block);
+      }
+      test_stencil_jacobi<Kokkos::Iterate::Right>(num_steps, 3);
+      test_stencil_jacobi<Kokkos::Iterate::Left>(num_steps, 4);
+    }
+  } else {
+    GTEST_SKIP() << "parallel_stencil requires a host execution space";
+  }
+}
+
+}  // namespace
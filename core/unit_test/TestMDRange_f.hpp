@@ -23,6 +23,26 @@ namespace Test {
 TEST(TEST_CATEGORY, mdrange_scalar) {
   TestMDRange_ReduceScalar<TEST_EXECSPACE>::test_scalar_reduce(12, 11);
 }
+
+TEST(TEST_CATEGORY, mdrange_tile_order) {
+  using Kokkos::Experimental::TileOrder;
+  using TestTileOrder = TestMDRange_TileOrder<TEST_EXECSPACE>;
+  TestTileOrder::test_curve_coordinates();
+  for (auto order :
+       {TileOrder::Default, TileOrder::Morton, TileOrder::Hilbert}) {
+    TestTileOrder::test_tile_order<Kokkos::Iterate::Right>(17, 10, 23, order);
+    TestTileOrder::test_tile_order<Kokkos::Iterate::Left>(17, 10, 23, order);
+    TestTileOrder::test_tile_order<Kokkos::Iterate::Right>(0, 10, 23, order);
+  }
+}
+
+TEST(TEST_CATEGORY, mdrange_static_tile) {
+  using TestStaticTile = TestMDRange_StaticTile<TEST_EXECSPACE>;
+  TestStaticTile::test_static_tile<Kokkos::Iterate::Right>(17, 10, 23);
+  TestStaticTile::test_static_tile<Kokkos::Iterate::Left>(17, 10, 23);
+  TestStaticTile::test_static_tile<Kokkos::Iterate::Right>(6, 4, 16);
+  TestStaticTile::test_static_tile<Kokkos::Iterate::Left>(2, 1, 7);
+}
 #endif
 
 }  // namespace Test
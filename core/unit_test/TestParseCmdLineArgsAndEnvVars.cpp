@@ -266,6 +266,24 @@ TEST(defaultdevicetype, cmd_line_args_tools_arguments) {
   EXPECT_TRUE(settings.has_tools_libs());
   EXPECT_EQ(settings.get_tools_libs(), "ich_tue_nur.so");
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+
+  cla      = {{
+      "--kokkos-tools-builtin=timer",
+  }};
+  settings = {};
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_tools_builtin());
+  EXPECT_EQ(settings.get_tools_builtin(), "timer");
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+
+  cla      = {{
+      "--kokkos-tools-sampling=percent:5,first:10",
+  }};
+  settings = {};
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_tools_sampling());
+  EXPECT_EQ(settings.get_tools_sampling(), "percent:5,first:10");
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
 }
 
 TEST(defaultdevicetype, cmd_line_args_unrecognized_flag) {
@@ -419,6 +437,17 @@ TEST(defaultdevicetype, env_vars_tune_internals) {
   }
 }
 
+TEST(defaultdevicetype, env_vars_tools_builtin) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_TOOLS_BUILTIN", "timer"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_tools_builtin());
+  EXPECT_EQ(settings.get_tools_builtin(), "timer");
+}
+
 TEST(defaultdevicetype, visible_devices) {
 #define KOKKOS_TEST_VISIBLE_DEVICES(ENV, CNT, DEV)                    \
   do {                                                                \
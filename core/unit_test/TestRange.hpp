@@ -294,6 +294,25 @@ struct TestRange {
   }
 };
 
+// A policy without schedule trait switched to a dynamic schedule at run
+// time, as done by tuning.
+template <class ExecSpace>
+void test_range_tuned_dynamic_schedule(int N) {
+  Kokkos::RangePolicy<ExecSpace> policy(0, N);
+  policy.impl_set_chunk_size(3);
+  policy.impl_set_dynamic_schedule(true);
+
+  Kokkos::View<int *, ExecSpace> a("A", N);
+  Kokkos::parallel_for(
+      policy, KOKKOS_LAMBDA(const int i) { a(i) += i; });
+
+  int error = 0;
+  Kokkos::parallel_reduce(
+      policy, KOKKOS_LAMBDA(const int i, int &lerror) { lerror += a(i) != i; },
+      error);
+  ASSERT_EQ(error, 0);
+}
+
 }  // namespace
 
 TEST(TEST_CATEGORY, range_for) {
@@ -355,6 +374,11 @@ TEST(TEST_CATEGORY, range_reduce) {
 }
 
 #ifndef KOKKOS_ENABLE_OPENMPTARGET
+TEST(TEST_CATEGORY, range_tuned_dynamic_schedule) {
+  test_range_tuned_dynamic_schedule<TEST_EXECSPACE>(0);
+  test_range_tuned_dynamic_schedule<TEST_EXECSPACE>(1001);
+}
+
 TEST(TEST_CATEGORY, range_dynamic_policy) {
 #if !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP) && \
     !defined(KOKKOS_ENABLE_SYCL)
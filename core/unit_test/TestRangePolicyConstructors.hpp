@@ -70,4 +70,43 @@ TEST(TEST_CATEGORY, range_policy_runtime_parameters) {
   }
 }
 
+TEST(TEST_CATEGORY, range_policy_tuning_parameters) {
+  using Policy = Kokkos::RangePolicy<>;
+  {
+    Policy p(0, 100);
+    ASSERT_TRUE(p.impl_auto_chunk_size());
+    ASSERT_TRUE(Policy::impl_auto_schedule());
+    ASSERT_FALSE(p.impl_dynamic_schedule());
+
+    // tuning keeps the chunk size automatic
+    p.impl_set_chunk_size(4);
+    p.impl_set_dynamic_schedule(true);
+    ASSERT_EQ(p.chunk_size(), 4);
+    ASSERT_TRUE(p.impl_auto_chunk_size());
+    ASSERT_TRUE(p.impl_dynamic_schedule());
+
+    Policy copy(p);
+    ASSERT_EQ(copy.chunk_size(), 4);
+    ASSERT_TRUE(copy.impl_dynamic_schedule());
+  }
+  {
+    Policy p(0, 100, Kokkos::ChunkSize(8));
+    ASSERT_FALSE(p.impl_auto_chunk_size());
+    ASSERT_FALSE(Policy(0, 100).set_chunk_size(8).impl_auto_chunk_size());
+  }
+  {
+    using StaticPolicy =
+        Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Static>>;
+    StaticPolicy p(0, 100);
+    ASSERT_FALSE(StaticPolicy::impl_auto_schedule());
+    p.impl_set_dynamic_schedule(true);
+    ASSERT_FALSE(p.impl_dynamic_schedule());
+
+    using DynamicPolicy =
+        Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Dynamic>>;
+    ASSERT_FALSE(DynamicPolicy::impl_auto_schedule());
+    ASSERT_TRUE(DynamicPolicy(0, 100).impl_dynamic_schedule());
+  }
+}
+
 }  // namespace
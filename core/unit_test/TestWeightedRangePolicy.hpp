@@ -0,0 +1,138 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace {
+
+struct WeightedTag {};
+
+template <class ExecSpace>
+struct TestWeightedRangePolicy {
+  using count_view = Kokkos::View<int*, typename ExecSpace::memory_space>;
+
+  count_view m_count;
+
+  KOKKOS_FUNCTION void operator()(const int64_t i) const {
+    Kokkos::atomic_inc(&m_count(i));
+  }
+
+  KOKKOS_FUNCTION void operator()(WeightedTag, const int64_t i) const {
+    Kokkos::atomic_add(&m_count(i), 2);
+  }
+
+  // Every part is a contiguous range and the parts cover [begin, end)
+  // without overlap, each with no more than its share of the cost plus the
+  // cost of one iteration
+  template <class Policy, class Cost>
+  static void check_bounds(const Policy& policy, const Cost& cost,
+                           const double max_cost) {
+    const auto& bounds = policy.impl_bounds();
+    ASSERT_EQ(int(bounds.extent(0)), policy.num_parts() + 1);
+    EXPECT_EQ(bounds(0), policy.begin());
+    EXPECT_EQ(bounds(policy.num_parts()), policy.end());
+
+    double total = 0;
+    for (int64_t i = policy.begin(); i < policy.end(); ++i) total += cost(i);
+    for (int part = 0; part < policy.num_parts(); ++part) {
+      ASSERT_LE(bounds(part), bounds(part + 1));
+      double part_cost = 0;
+      for (int64_t i = bounds(part); i < bounds(part + 1); ++i) {
+        part_cost += cost(i);
+      }
+      EXPECT_LE(part_cost, total / policy.num_parts() + max_cost);
+    }
+  }
+
+  void check_count(const int64_t begin, const int64_t end, const int value) {
+    for (int64_t i = 0; i < int64_t(m_count.extent(0)); ++i) {
+      ASSERT_EQ(m_count(i), begin <= i && i < end ? value : 0) << "at " << i;
+    }
+  }
+
+  void test_view_costs(const int64_t n) {
+    using policy_type = Kokkos::Experimental::WeightedRangePolicy<ExecSpace>;
+
+    // the first eighth of the iterations does most of the work
+    Kokkos::View<double*, Kokkos::HostSpace> cost("cost", n);
+    for (int64_t i = 0; i < n; ++i) cost(i) = i < n / 8 ? 100 : 1;
+
+    m_count = count_view("count", n);
+    const policy_type policy(0, n, cost);
+    check_bounds(policy, cost, 100);
+    Kokkos::parallel_for("Test::WeightedRangePolicy::View", policy, *this);
+    Kokkos::fence();
+    check_count(0, n, 1);
+
+    // without a version of the costs every policy computes its partition
+    const policy_type again(ExecSpace(), 0, n, cost);
+    EXPECT_NE(again.impl_bounds().data(), policy.impl_bounds().data());
+
+    // a versioned policy reuses the partition of the same version
+    const policy_type versioned(ExecSpace(), 0, n, cost, 1);
+    const policy_type same_version(0, n, cost, 1);
+    EXPECT_EQ(same_version.impl_bounds().data(),
+              versioned.impl_bounds().data());
+
+    // the costs modified in place come with a new version
+    for (int64_t i = 0; i < n; ++i) cost(i) = i < n / 8 ? 1 : 100;
+    const policy_type new_version(0, n, cost, 2);
+    EXPECT_NE(new_version.impl_bounds().data(),
+              versioned.impl_bounds().data());
+    check_bounds(new_version, cost, 100);
+    const policy_type unversioned(0, n, cost);
+    check_bounds(unversioned, cost, 100);
+
+    // or are refreshed explicitly under the old one
+    policy_type updated(0, n, cost, 1);
+    updated.update_costs(cost);
+    check_bounds(updated, cost, 100);
+    const policy_type cached(0, n, cost, 1);
+    EXPECT_EQ(cached.impl_bounds().data(), updated.impl_bounds().data());
+  }
+
+  void test_functor_costs(const int64_t begin, const int64_t end) {
+    using policy_type =
+        Kokkos::Experimental::WeightedRangePolicy<ExecSpace, WeightedTag>;
+
+    auto cost = [](const int64_t i) { return i % 7 == 0 ? 50 : i % 3; };
+
+    m_count = count_view("count", end + 5);
+    const policy_type policy(begin, end, cost);
+    check_bounds(policy, cost, 50);
+    Kokkos::parallel_for(policy, *this);
+    Kokkos::fence();
+    check_count(begin, end, 2);
+  }
+};
+
+TEST(TEST_CATEGORY, weighted_range_policy) {
+  if constexpr (Kokkos::SpaceAccessibility<TEST_EXECSPACE,
+                                           Kokkos::HostSpace>::accessible) {
+    TestWeightedRangePolicy<TEST_EXECSPACE> test;
+    for (int64_t n : {0, 1, 3, 100, 10007}) test.test_view_costs(n);
+    test.test_functor_costs(0, 0);
+    test.test_functor_costs(17, 18);
+    test.test_functor_costs(3, 1000);
+    test.test_functor_costs(100, 20000);
+  } else {
+    GTEST_SKIP() << "WeightedRangePolicy requires a host execution space";
+  }
+}
+
+}  // namespace
@@ -0,0 +1,66 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// Helpers of the tests of the builtin tools, which initialize Kokkos with a
+// tool, run a few kernels and check the files the tool writes at finalize
+
+#ifndef KOKKOS_BUILTIN_TOOL_TEST_HELPERS_HPP
+#define KOKKOS_BUILTIN_TOOL_TEST_HELPERS_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace Test {
+
+inline void set_env(char const* name, std::string const& value) {
+#ifdef _WIN32
+  _putenv((std::string(name) + "=" + value).c_str());
+#else
+  setenv(name, value.c_str(), 1);
+#endif
+}
+
+// Runs kernels() between initialize and finalize with the builtin tools, a
+// comma separated list, writing their output files with the given prefix
+template <class Kernels>
+void run_with_builtin_tools(std::string const& prefix, char const* tools,
+                            Kernels const& kernels,
+                            Kokkos::InitializationSettings settings = {}) {
+  set_env("KOKKOS_TOOLS_BUILTIN_OUTPUT", prefix);
+  Kokkos::initialize(settings.set_tools_builtin(tools));
+  kernels();
+  Kokkos::finalize();
+}
+
+// Returns the contents of an output file and removes the file
+inline std::string take_output(std::string const& file_name) {
+  std::stringstream ss;
+  {
+    std::ifstream in(file_name);
+    ss << in.rdbuf();
+  }
+  std::remove(file_name.c_str());
+  return ss.str();
+}
+
+}  // namespace Test
+
+#endif
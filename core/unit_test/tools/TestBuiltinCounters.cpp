@@ -0,0 +1,67 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with the builtin counters tool and checks the
+// report it writes at finalize. Which counters are available depends on the
+// system, so only the launch counts are checked exactly.
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "BuiltinToolTestHelpers.hpp"
+
+#include <regex>
+#include <string>
+
+namespace Test {
+
+void run_kernels() {
+  Kokkos::View<double*> v("v", 10000);
+  for (int i = 0; i < 3; ++i) {
+    Kokkos::parallel_for(
+        "builtin_counters_for", v.size(),
+        KOKKOS_LAMBDA(int j) { v(j) = 2. * j; });
+  }
+  double sum = 0.;
+  Kokkos::parallel_reduce(
+      "builtin_counters_reduce", v.size(),
+      KOKKOS_LAMBDA(int j, double& update) { update += v(j); }, sum);
+  EXPECT_EQ(sum, 9999. * 10000.);
+}
+
+TEST(tools, builtin_counters) {
+  std::string const prefix = "kokkos_builtin_counters_test";
+  run_with_builtin_tools(prefix, "counters", run_kernels);
+
+  auto const text = take_output(prefix + ".counters.txt");
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("Kokkos builtin counters, threads: [1-9][0-9]*")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("all +3 .* builtin_counters_for\n")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("all +1 .* builtin_counters_reduce\n")))
+      << text;
+
+  auto const json = take_output(prefix + ".counters.json");
+  EXPECT_NE(json.find("{\"name\": \"builtin_counters_for\", \"launches\": 3, "
+                      "\"samples\": 3, \"counters\": {"),
+            std::string::npos)
+      << json;
+}
+
+}  // namespace Test
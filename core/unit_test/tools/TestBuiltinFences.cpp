@@ -0,0 +1,70 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with the builtin fence audit and checks the
+// report it writes at finalize. The timer is enabled too, so that Kokkos
+// fences around every kernel, which the audit must leave out.
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "BuiltinToolTestHelpers.hpp"
+
+#include <regex>
+#include <string>
+
+namespace Test {
+
+void run_kernels() {
+  Kokkos::parallel_for("builtin_fences_kernel", 10, KOKKOS_LAMBDA(int){});
+  Kokkos::fence("builtin_fences_busy");
+  for (int i = 0; i < 2; ++i) {
+    Kokkos::fence("builtin_fences_idle");
+  }
+  // fences of an instance are not global
+  Kokkos::DefaultExecutionSpace().fence("builtin_fences_instance");
+}
+
+TEST(tools, builtin_fences) {
+  std::string const prefix = "kokkos_builtin_fences_test";
+  run_with_builtin_tools(prefix, "fences,timer", run_kernels);
+  // the timer only serves to make Kokkos fence around kernels
+  take_output(prefix + ".timer.txt");
+  take_output(prefix + ".timer.json");
+  std::string const space = Kokkos::DefaultExecutionSpace::name();
+
+  auto const text = take_output(prefix + ".fences.txt");
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("#[0-9]+ +1 +[^ ]+ +[^ ]+ +0  " + space +
+                       " +builtin_fences_busy\n")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("#[0-9]+ +2 +[^ ]+ +[^ ]+ +2  " + space +
+                       " +builtin_fences_idle\n")))
+      << text;
+  EXPECT_EQ(text.find("builtin_fences_instance"), std::string::npos) << text;
+  EXPECT_EQ(text.find("Kokkos Profile Tool Fence"), std::string::npos) << text;
+  EXPECT_NE(text.find("Call stacks, innermost first:"), std::string::npos)
+      << text;
+
+  auto const json = take_output(prefix + ".fences.json");
+  EXPECT_NE(json.find("{\"name\": \"builtin_fences_idle\", \"space\": \"" +
+                      space + "\", \"count\": 2,"),
+            std::string::npos)
+      << json;
+}
+
+}  // namespace Test
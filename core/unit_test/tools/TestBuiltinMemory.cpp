@@ -0,0 +1,71 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with the builtin memory profiler and checks the
+// report it writes at finalize
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "BuiltinToolTestHelpers.hpp"
+
+#include <regex>
+#include <string>
+
+namespace Test {
+
+void run_kernels() {
+  Kokkos::View<char*, Kokkos::HostSpace> small("builtin_memory_small", 1000);
+  for (int i = 0; i < 5; ++i) {
+    Kokkos::View<char*, Kokkos::HostSpace> tmp("builtin_memory_temporary",
+                                               100);
+  }
+  Kokkos::Profiling::pushRegion("builtin_memory_outer");
+  Kokkos::Profiling::pushRegion("builtin_memory_inner");
+  Kokkos::View<char*, Kokkos::HostSpace> large("builtin_memory_large",
+                                               1 << 20);
+  Kokkos::Profiling::popRegion();
+  Kokkos::Profiling::popRegion();
+}
+
+TEST(tools, builtin_memory) {
+  std::string const prefix = "kokkos_builtin_memory_test";
+  run_with_builtin_tools(prefix, "memory", run_kernels);
+
+  auto const text = take_output(prefix + ".memory.txt");
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("regions at peak: builtin_memory_outer / "
+                       "builtin_memory_inner\n")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("1.0 MiB  builtin_memory_large\n")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex(" +5 +5 .* builtin_memory_temporary\n")))
+      << text;
+
+  auto const json = take_output(prefix + ".memory.json");
+  EXPECT_NE(json.find("{\"label\": \"builtin_memory_large\", \"bytes\": "
+                      "1048576}"),
+            std::string::npos)
+      << json;
+  EXPECT_NE(json.find("\"label\": \"builtin_memory_temporary\", "
+                      "\"allocations\": 5, \"deallocations\": 5,"),
+            std::string::npos)
+      << json;
+}
+
+}  // namespace Test
@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with the builtin timer tool and checks the
+// summary it writes at finalize
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "BuiltinToolTestHelpers.hpp"
+
+#include <regex>
+#include <string>
+#include <type_traits>
+
+namespace Test {
+
+void run_kernels() {
+  Kokkos::View<int*> v("v", 100);
+  Kokkos::Profiling::pushRegion("builtin_timer_region");
+  for (int i = 0; i < 3; ++i) {
+    Kokkos::parallel_for(
+        "builtin_timer_for", v.size(), KOKKOS_LAMBDA(int j) { v(j) = j; });
+  }
+  int sum = 0;
+  Kokkos::parallel_reduce(
+      "builtin_timer_reduce", v.size(),
+      KOKKOS_LAMBDA(int j, int& update) { update += v(j); }, sum);
+  {
+    Kokkos::Tools::Experimental::ScopedKernelWork work(
+        2 * sizeof(int), 1,
+        Kokkos::Tools::Experimental::KernelWorkUnit::per_iteration);
+    Kokkos::parallel_for(
+        "builtin_timer_work", v.size(),
+        KOKKOS_LAMBDA(int j) { v(j) = 2 * v(j); });
+  }
+  Kokkos::Profiling::popRegion();
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(tools, builtin_timer) {
+  std::string const prefix = "kokkos_builtin_timer_test";
+  run_with_builtin_tools(prefix, "timer", run_kernels);
+
+  auto const text = take_output(prefix + ".timer.txt");
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("parallel_for +3 .* builtin_timer_for\n")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("parallel_reduce +1 .* builtin_timer_reduce\n")))
+      << text;
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex("region +1 .* builtin_timer_region\n")))
+      << text;
+  // host backends report the work of their threads, regions have none
+#ifndef KOKKOS_ENABLE_HPX
+  if (std::is_same<Kokkos::DefaultExecutionSpace,
+                   Kokkos::DefaultHostExecutionSpace>::value) {
+    EXPECT_TRUE(std::regex_search(
+        text, std::regex(" [0-9]+\\.[0-9]{2} +- +- +-  builtin_timer_for\n")))
+        << text;
+  }
+#endif
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex(" -  builtin_timer_region\n")))
+      << text;
+  // host kernels with declared work are compared to the peak of the host,
+  // which is measured without showing up as kernels
+  constexpr bool on_host = std::is_same_v<Kokkos::DefaultExecutionSpace,
+                                          Kokkos::DefaultHostExecutionSpace>;
+  EXPECT_EQ(std::regex_search(
+                text, std::regex("Host peak: [0-9.]+ GB/s, [0-9.]+ GFLOP/s")),
+            on_host)
+      << text;
+  std::string const peak_fraction = on_host ? "[0-9.]+" : "-";
+  EXPECT_TRUE(std::regex_search(
+      text, std::regex(" [0-9.]+ +[0-9.]+ +" + peak_fraction +
+                       "  builtin_timer_work\n")))
+      << text;
+  EXPECT_EQ(text.find("host_peak"), std::string::npos) << text;
+
+  auto const json = take_output(prefix + ".timer.json");
+  EXPECT_NE(json.find("{\"name\": \"builtin_timer_for\", \"type\": "
+                      "\"parallel_for\", \"count\": 3,"),
+            std::string::npos)
+      << json;
+  EXPECT_NE(json.find("{\"name\": \"builtin_timer_region\", \"type\": "
+                      "\"region\", \"count\": 1,"),
+            std::string::npos)
+      << json;
+  EXPECT_NE(json.find("\"bytes\": 800, \"flops\": 100,"), std::string::npos)
+      << json;
+  EXPECT_EQ(json.find("\"host_peak\": {") != std::string::npos, on_host)
+      << json;
+}
+
+}  // namespace Test
@@ -0,0 +1,82 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with the builtin trace tool and a small event
+// buffer and checks the timeline it writes at finalize
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "BuiltinToolTestHelpers.hpp"
+
+#include <regex>
+#include <string>
+
+namespace Test {
+
+void run_kernels() {
+  // overflow the buffer so that the oldest launches are dropped
+  for (int i = 0; i < 100; ++i) {
+    Kokkos::parallel_for("builtin_trace_dropped", 1, KOKKOS_LAMBDA(int){});
+  }
+  Kokkos::View<int*> v("builtin_trace_dst", 10);
+  Kokkos::View<int*> w("builtin_trace_src", 10);
+  Kokkos::Profiling::pushRegion("builtin_trace_region");
+  Kokkos::parallel_for(
+      "builtin_trace_for", v.size(), KOKKOS_LAMBDA(int j) { w(j) = j; });
+  Kokkos::deep_copy(v, w);
+  Kokkos::DefaultExecutionSpace().fence("builtin_trace_fence");
+  Kokkos::Profiling::popRegion();
+}
+
+TEST(tools, builtin_trace) {
+  std::string const prefix = "kokkos_builtin_trace_test";
+  set_env("KOKKOS_TOOLS_BUILTIN_TRACE_EVENTS", "32");
+
+  run_with_builtin_tools(prefix, "trace", run_kernels);
+
+  auto const json = take_output(prefix + ".trace.json");
+  auto contains = [&](std::string const& pattern) {
+    return std::regex_search(json, std::regex(pattern));
+  };
+  EXPECT_TRUE(contains(
+      R"(\{"name": "builtin_trace_for", "cat": "parallel_for", "ph": "X", )"
+      R"("ts": [0-9.]+, "dur": [0-9.]+, "pid": [1-9][0-9]*, "tid": 0\})"))
+      << json;
+  EXPECT_TRUE(contains(
+      R"(\{"name": "builtin_trace_fence", "cat": "fence", "ph": "X", .*)"
+      R"("pid": [1-9][0-9]*, "tid": 0\})"))
+      << json;
+  EXPECT_TRUE(contains(
+      R"(\{"name": "builtin_trace_dst", "cat": "deep_copy", "ph": "X", .*)"
+      R"("pid": 0, "tid": 0, "args": \{"src": "builtin_trace_src", )"
+      R"("dst_space": "Host", "src_space": "Host", "bytes": 40\}\})"))
+      << json;
+  EXPECT_TRUE(contains(
+      R"(\{"name": "builtin_trace_region", "cat": "region", "ph": "X", .*)"
+      R"("pid": 0, "tid": 0\})"))
+      << json;
+  EXPECT_TRUE(
+      contains(R"("name": "process_name", "ph": "M", "pid": [1-9][0-9]*, )"
+               R"("tid": 0, "args": \{"name": "[A-Za-z]+ device 0 )"
+               R"(instance [0-9]+"\})"))
+      << json;
+  EXPECT_TRUE(contains(R"("dropped_events": [1-9][0-9]*, )"
+                       R"("events_per_thread": 32)"))
+      << json;
+}
+
+}  // namespace Test
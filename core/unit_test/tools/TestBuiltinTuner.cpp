@@ -0,0 +1,114 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with the builtin tuner, starting from a file
+// of learned choices, and checks the choices and the file written at finalize
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "BuiltinToolTestHelpers.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Test {
+
+void run_kernels() {
+  using namespace Kokkos::Tools::Experimental;
+  // the choice learned in a previous run is used from the start
+  auto learned = make_categorical_tuner("builtin_tuner_learned",
+                                        std::vector<int>{10, 20});
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(learned.begin(), 20);
+    learned.end();
+  }
+
+  // every choice is measured once, then the fastest one is kept
+  auto search = make_categorical_tuner("builtin_tuner_search",
+                                       std::vector<int>{0, 1, 2, 3});
+  int fastest = 0;
+  for (int i = 0; i < 20; ++i) {
+    int const choice = search.begin();
+    if (choice != 2) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    fastest += choice == 2;
+    search.end();
+  }
+  EXPECT_EQ(fastest, 17);
+
+  // the tile sizes of kernels are tuned per kernel name
+  using mdrange_policy =
+      Kokkos::MDRangePolicy<Kokkos::DefaultHostExecutionSpace, Kokkos::Rank<2>>;
+  for (int i = 0; i < 3; ++i) {
+    Kokkos::parallel_for("builtin_tuner_tiles",
+                         mdrange_policy({0, 0}, {64, 64}),
+                         KOKKOS_LAMBDA(int, int){});
+  }
+
+  // and so are the schedule and chunk size of range kernels, separately for
+  // every power of two bucket of range lengths
+  for (int i = 0; i < 3; ++i) {
+    Kokkos::parallel_for(
+        "builtin_tuner_range",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, 1000),
+        KOKKOS_LAMBDA(int){});
+    Kokkos::parallel_for(
+        "builtin_tuner_range",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, 100000),
+        KOKKOS_LAMBDA(int){});
+  }
+}
+
+TEST(tools, builtin_tuner) {
+  std::string const file = "kokkos_builtin_tuner_test.txt";
+  {
+    std::ofstream out(file);
+    out << "builtin_tuner_learned\t0\t10\t0.002\n"
+        << "builtin_tuner_learned\t1\t10\t0.001\n";
+  }
+  set_env("KOKKOS_TOOLS_BUILTIN_TUNER_FILE", file);
+  set_env("KOKKOS_TOOLS_BUILTIN_TUNER_EPSILON", "0");
+
+  run_with_builtin_tools(
+      "kokkos_builtin_tuner_test", "tuner", run_kernels,
+      Kokkos::InitializationSettings().set_tune_internals(true));
+
+  auto const text = take_output(file);
+  EXPECT_NE(text.find("\nbuiltin_tuner_learned\t1\t15\t"), std::string::npos)
+      << text;
+  EXPECT_NE(text.find("\nbuiltin_tuner_search\t2\t17\t"), std::string::npos)
+      << text;
+  EXPECT_NE(text.find("kokkos.kernel_name=builtin_tuner_tiles"),
+            std::string::npos)
+      << text;
+  EXPECT_NE(text.find("\nbuiltin_tuner_range_length_bits_10_schedule;"
+                      "builtin_tuner_range_length_bits_10_chunk_size @ "
+                      "kokkos.kernel_name=builtin_tuner_range"),
+            std::string::npos)
+      << text;
+  EXPECT_NE(text.find("\nbuiltin_tuner_range_length_bits_17_schedule;"
+                      "builtin_tuner_range_length_bits_17_chunk_size @ "
+                      "kokkos.kernel_name=builtin_tuner_range"),
+            std::string::npos)
+      << text;
+}
+
+}  // namespace Test
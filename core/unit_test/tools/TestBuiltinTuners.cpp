@@ -23,6 +23,9 @@ struct TestTeamFunctor {
 struct TestMDFunctor {
   KOKKOS_FUNCTION void operator()(const int, const int) const {}
 };
+struct TestRangeFunctor {
+  KOKKOS_FUNCTION void operator()(const int) const {}
+};
 int main(int argc, char* argv[]) {
   Kokkos::initialize(argc, argv);
   {
@@ -91,6 +94,59 @@ int main(int argc, char* argv[]) {
       new_team_tuner.end();
     }
     end_context(kernel_context);
+
+    Kokkos::RangePolicy<ExecSpace> rangep(0, 1000);
+    Kokkos::Tools::Experimental::RangePolicyTuner range_tune_this(
+        "range_tuner", rangep, TestRangeFunctor{}, Kokkos::ParallelForTag{},
+        Kokkos::Tools::Experimental::Impl::Impl::SimpleTeamSizeCalculator{});
+    auto new_range_tuner = range_tune_this.combine("options", options);
+
+    // the static schedule comes first, with the chunk size Kokkos chose, the
+    // dynamic one starts with a chunk size of one
+    auto static_point = new_range_tuner.get_point(0.0, 0.0, 0.0);
+    assert(std::get<1>(static_point) == 0);
+    assert(std::get<2>(static_point) == rangep.chunk_size());
+    (void)static_point;
+    auto dynamic_point = new_range_tuner.get_point(0.0, 0.9, 0.0);
+    assert(std::get<1>(dynamic_point) == 1);
+    assert(std::get<2>(dynamic_point) == 1);
+    (void)dynamic_point;
+
+    // launches are tuned per power of two bucket of the range length, the
+    // buckets of longer ranges try larger dynamic chunk sizes
+    using Kokkos::Tools::Experimental::RangePolicyTuner;
+    assert(RangePolicyTuner::length_bucket(rangep) == 10);
+    assert(RangePolicyTuner::length_bucket(
+               Kokkos::RangePolicy<ExecSpace>(0, 1024)) == 11);
+    assert(RangePolicyTuner::length_bucket(
+               Kokkos::RangePolicy<ExecSpace>(7, 7)) == 0);
+    Kokkos::RangePolicy<ExecSpace> long_rangep(0, 1000000);
+    RangePolicyTuner long_range_tuner(
+        "range_tuner", long_rangep, TestRangeFunctor{},
+        Kokkos::ParallelForTag{},
+        Kokkos::Tools::Experimental::Impl::Impl::SimpleTeamSizeCalculator{});
+    auto largest_chunk = range_tune_this.get_tuner().get_point(0.9, 0.999);
+    auto long_largest_chunk =
+        long_range_tuner.get_tuner().get_point(0.9, 0.999);
+    assert(std::get<0>(largest_chunk) == 1);
+    assert(std::get<0>(long_largest_chunk) == 1);
+    assert(std::get<1>(long_largest_chunk) > std::get<1>(largest_chunk));
+    (void)largest_chunk;
+    (void)long_largest_chunk;
+
+    begin_context(kernel_context);
+    set_input_values(kernel_context, 1, &md_kernel_value);
+    for (int x = 0; x < 10000; ++x) {
+      auto config = new_range_tuner.begin();
+      int option  = std::get<0>(config);
+      (void)option;
+      Kokkos::RangePolicy<ExecSpace> policy(0, 1000);
+      policy.impl_set_dynamic_schedule(std::get<1>(config) == 1);
+      policy.impl_set_chunk_size(std::get<2>(config));
+      Kokkos::parallel_for("range", policy, TestRangeFunctor{});
+      new_range_tuner.end();
+    }
+    end_context(kernel_context);
   }
   Kokkos::finalize();
 }
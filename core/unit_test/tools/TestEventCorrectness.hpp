@@ -331,6 +331,107 @@ TEST(kokkosp, parallel_for) {
   ASSERT_TRUE(success);
 }
 
+/**
+ * Test that tools receive the same interned name for every launch of a
+ * kernel, whether or not the label is the same string object
+ */
+std::vector<char const*> interned_kernel_names;
+TEST(kokkosp, interned_kernel_names) {
+  interned_kernel_names.clear();
+  Kokkos::Tools::Experimental::set_begin_parallel_for_callback(
+      [](char const* name, uint32_t, uint64_t*) {
+        interned_kernel_names.push_back(name);
+      });
+  TestFunctor tf;
+  std::string const label = "interned";
+  Kokkos::parallel_for(label, Kokkos::RangePolicy<>(0, 1), tf);
+  Kokkos::parallel_for(label, Kokkos::RangePolicy<>(0, 1), tf);
+  Kokkos::parallel_for("interned", Kokkos::RangePolicy<>(0, 1), tf);
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, 1), tf);
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, 1), tf);
+  Kokkos::Tools::Experimental::set_begin_parallel_for_callback(nullptr);
+
+  ASSERT_EQ(interned_kernel_names.size(), 5u);
+  EXPECT_STREQ(interned_kernel_names[0], "interned");
+  EXPECT_EQ(interned_kernel_names[0], interned_kernel_names[1]);
+  EXPECT_EQ(interned_kernel_names[0], interned_kernel_names[2]);
+  EXPECT_EQ(interned_kernel_names[3], interned_kernel_names[4]);
+  EXPECT_NE(interned_kernel_names[0], interned_kernel_names[3]);
+}
+
+struct ThreadWorkRecord {
+  uint32_t calls          = 0;
+  uint32_t num_threads    = 0;
+  uint64_t iterations     = 0;
+  bool busy_seconds_valid = true;
+};
+ThreadWorkRecord thread_work_record;
+TEST(kokkosp, thread_work) {
+  using ExecutionSpace = Kokkos::DefaultHostExecutionSpace;
+#ifdef KOKKOS_ENABLE_HPX
+  if (std::is_same<ExecutionSpace, Kokkos::Experimental::HPX>::value) {
+    GTEST_SKIP() << "HPX does not record the work of its threads";
+  }
+#endif
+  thread_work_record = {};
+  Kokkos::Tools::Experimental::set_thread_work_callback(
+      [](uint32_t num_threads, uint64_t const* iterations,
+         double const* busy_seconds) {
+        ++thread_work_record.calls;
+        thread_work_record.num_threads = num_threads;
+        for (uint32_t i = 0; i < num_threads; ++i) {
+          thread_work_record.iterations += iterations[i];
+          thread_work_record.busy_seconds_valid &= busy_seconds[i] >= 0.;
+        }
+      });
+  int const n = 1000;
+  Kokkos::parallel_for("thread_work", Kokkos::RangePolicy<ExecutionSpace>(0, n),
+                       TestFunctor{});
+  int result = 0;
+  Kokkos::parallel_reduce("thread_work",
+                          Kokkos::RangePolicy<ExecutionSpace>(0, n),
+                          TestReduceFunctor{}, result);
+  Kokkos::Tools::Experimental::set_thread_work_callback(nullptr);
+
+  EXPECT_EQ(thread_work_record.calls, 2u);
+  EXPECT_EQ(thread_work_record.num_threads,
+            uint32_t(ExecutionSpace().concurrency()));
+  EXPECT_EQ(thread_work_record.iterations, uint64_t(2 * n));
+  EXPECT_TRUE(thread_work_record.busy_seconds_valid);
+}
+
+std::vector<std::pair<double, double>> kernel_work_records;
+TEST(kokkosp, kernel_work) {
+  using namespace Kokkos::Tools::Experimental;
+  kernel_work_records.clear();
+  set_kernel_work_callback([](uint64_t, double bytes, double flops) {
+    kernel_work_records.emplace_back(bytes, flops);
+  });
+  int const n = 100;
+  {
+    ScopedKernelWork work(16., 2., KernelWorkUnit::per_iteration);
+    Kokkos::parallel_for("kernel_work", n, TestFunctor{});
+    Kokkos::parallel_for(
+        "kernel_work",
+        Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {n, 3}),
+        KOKKOS_LAMBDA(int, int){});
+    Kokkos::parallel_for(
+        "kernel_work", Kokkos::TeamPolicy<>(5, Kokkos::AUTO),
+        KOKKOS_LAMBDA(Kokkos::TeamPolicy<>::member_type const&){});
+    {
+      ScopedKernelWork inner(1000., 10.);
+      Kokkos::parallel_for("kernel_work", n, TestFunctor{});
+    }
+  }
+  Kokkos::parallel_for("kernel_work", n, TestFunctor{});
+  set_kernel_work_callback(nullptr);
+
+  std::vector<std::pair<double, double>> const expected = {
+      {16. * n, 2. * n}, {16. * n * 3, 2. * n * 3}, {16. * 5, 2. * 5},
+      {1000., 10.}};
+  EXPECT_EQ(kernel_work_records, expected);
+}
+
 #ifndef KOKKOS_ENABLE_OPENACC
 // FIXME_OPENACC: not supported reducer type
 TEST(kokkosp, parallel_reduce) {
@@ -0,0 +1,90 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file initializes Kokkos with sampling of kernel launches and checks
+// which events reach the tool
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+namespace {
+
+int begin_sampled_count = 0;
+int end_sampled_count   = 0;
+int push_region_count   = 0;
+std::string sampling_metadata;
+
+struct SampledFunctor {
+  KOKKOS_FUNCTION void operator()(int) const {}
+};
+
+TEST(tools, sampling) {
+  using Kokkos::Tools::Impl::configure_sampling;
+  using Kokkos::Tools::Impl::InitializationStatus;
+  ::testing::internal::CaptureStderr();
+  EXPECT_EQ(configure_sampling("every:0").result,
+            InitializationStatus::InitializationResult::failure);
+  EXPECT_EQ(configure_sampling("percent:150").result,
+            InitializationStatus::InitializationResult::failure);
+  EXPECT_EQ(configure_sampling("first:3").result,
+            InitializationStatus::InitializationResult::failure);
+  EXPECT_EQ(configure_sampling("every:2,percent:50").result,
+            InitializationStatus::InitializationResult::failure);
+  EXPECT_EQ(configure_sampling("every:2,frist:1").result,
+            InitializationStatus::InitializationResult::failure);
+  auto const captured = ::testing::internal::GetCapturedStderr();
+  EXPECT_NE(captured.find("frist:1"), std::string::npos) << captured;
+  EXPECT_FALSE(Kokkos::Tools::Impl::sampling_enabled());
+
+  Kokkos::Tools::Experimental::set_begin_parallel_for_callback(
+      [](char const* name, uint32_t, uint64_t*) {
+        if (std::strcmp(name, "sampled") == 0) ++begin_sampled_count;
+      });
+  Kokkos::Tools::Experimental::set_end_parallel_for_callback(
+      [](uint64_t) { ++end_sampled_count; });
+  Kokkos::Tools::Experimental::set_push_region_callback(
+      [](char const*) { ++push_region_count; });
+  Kokkos::Tools::Experimental::set_declare_metadata_callback(
+      [](char const* key, char const* value) {
+        if (std::strcmp(key, "tools_sampling") == 0) sampling_metadata = value;
+      });
+
+  Kokkos::initialize(
+      Kokkos::InitializationSettings().set_tools_sampling("every:4,first:2"));
+  EXPECT_TRUE(Kokkos::Tools::Impl::sampling_enabled());
+  EXPECT_EQ(sampling_metadata, "every:4,first:2");
+
+  // launches 0 and 1 are always sampled, then every 4th: 2 and 6
+  for (int i = 0; i < 8; ++i) {
+    Kokkos::parallel_for("sampled", Kokkos::RangePolicy<>(0, 1),
+                         SampledFunctor{});
+    Kokkos::Profiling::pushRegion("not sampled");
+    Kokkos::Profiling::popRegion();
+  }
+  EXPECT_EQ(begin_sampled_count, 4);
+  EXPECT_EQ(end_sampled_count, 4);
+  EXPECT_EQ(push_region_count, 8);
+
+  EXPECT_EQ(Kokkos::Tools::Impl::sampling_weight(0), 1.);
+  EXPECT_EQ(Kokkos::Tools::Impl::sampling_weight(1), 1.);
+  EXPECT_EQ(Kokkos::Tools::Impl::sampling_weight(2), 4.);
+  Kokkos::finalize();
+}
+
+}  // namespace
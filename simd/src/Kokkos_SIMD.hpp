@@ -159,9 +159,70 @@ using data_type_set = data_types<std::int32_t, std::uint32_t, std::int64_t,
 
 using device_abi_set = abi_set<simd_abi::scalar>;
 
+// ranks the Abi types by capability. they only exist for the instruction
+// set the program is compiled for, a more capable one implying the others.
+template <class Abi>
+struct abi_capability;
+
+template <>
+struct abi_capability<simd_abi::scalar> : std::integral_constant<int, 0> {};
+
+#ifdef __ARM_NEON
+template <>
+struct abi_capability<simd_abi::neon_fixed_size<2>>
+    : std::integral_constant<int, 1> {};
+#endif
+
+#ifdef KOKKOS_ARCH_AVX2
+template <>
+struct abi_capability<simd_abi::avx2_fixed_size<4>>
+    : std::integral_constant<int, 1> {};
+#endif
+
+#ifdef KOKKOS_ARCH_AVX512XEON
+template <>
+struct abi_capability<simd_abi::avx512_fixed_size<8>>
+    : std::integral_constant<int, 2> {};
+#endif
+
+// the most capable Abi of a set, the first one among equally capable ones
+template <class... Abis>
+struct most_capable_abi;
+
+template <class Abi>
+struct most_capable_abi<Abi> {
+  using type = Abi;
+};
+
+template <class Abi, class... Abis>
+struct most_capable_abi<Abi, Abis...> {
+  using rest_type = typename most_capable_abi<Abis...>::type;
+  using type =
+      std::conditional_t<(abi_capability<Abi>::value <
+                          abi_capability<rest_type>::value),
+                         rest_type, Abi>;
+};
+
 }  // namespace Impl
 
+/// Calls functor(Abi()) with the most capable Abi in abis. The Abi types are
+/// only enabled for the instruction set the whole program is compiled for
+/// through KOKKOS_ARCH, so the choice is made at compile time and the functor
+/// is only instantiated for that Abi. There is no selection at run time.
+template <class... Abis, class Functor>
+inline void simd_dispatch(Impl::abi_set<Abis...>, Functor&& functor) {
+  using abi_type = typename Impl::most_capable_abi<Abis...>::type;
+  std::forward<Functor>(functor)(abi_type());
+}
+
+template <class Functor>
+inline void simd_dispatch(Functor&& functor) {
+  simd_dispatch(Impl::host_abi_set(), std::forward<Functor>(functor));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
+#include <Kokkos_SIMD_Range.hpp>
+
 #endif
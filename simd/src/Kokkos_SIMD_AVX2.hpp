@@ -18,6 +18,7 @@
 #define KOKKOS_SIMD_AVX2_HPP
 
 #include <functional>
+#include <limits>
 #include <type_traits>
 
 #include <Kokkos_SIMD_Common.hpp>
@@ -408,6 +409,14 @@ class simd<double, simd_abi::avx2_fixed_size<4>> {
       value_type* ptr, element_aligned_tag) const {
     _mm256_storeu_pd(ptr, m_value);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_pd(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm256_store_pd(ptr, m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256d()
       const {
     return m_value;
@@ -571,7 +580,7 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<4>> {
   using value_type = std::int32_t;
   using abi_type   = simd_abi::avx2_fixed_size<4>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_int32_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -601,11 +610,11 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<4>> {
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
       simd<std::uint64_t, abi_type> const& other);
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int32_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int32_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -615,6 +624,14 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<4>> {
       value_type* ptr, element_aligned_tag) const {
     _mm_maskstore_epi32(ptr, static_cast<__m128i>(mask_type(true)), m_value);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm_load_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m128i()
       const {
     return m_value;
@@ -682,7 +699,7 @@ class simd<std::int64_t, simd_abi::avx2_fixed_size<4>> {
   using value_type = std::int64_t;
   using abi_type   = simd_abi::avx2_fixed_size<4>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_int64_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -715,11 +732,11 @@ class simd<std::int64_t, simd_abi::avx2_fixed_size<4>> {
       simd<std::int32_t, abi_type> const& other)
       : m_value(_mm256_cvtepi32_epi64(static_cast<__m128i>(other))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int64_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int64_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -731,6 +748,14 @@ class simd<std::int64_t, simd_abi::avx2_fixed_size<4>> {
     _mm256_maskstore_epi64(reinterpret_cast<long long*>(ptr),
                            static_cast<__m256i>(mask_type(true)), m_value);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256i()
       const {
     return m_value;
@@ -803,7 +828,7 @@ class simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> {
   using value_type = std::uint64_t;
   using abi_type   = simd_abi::avx2_fixed_size<4>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_uint64_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -837,17 +862,30 @@ class simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> {
       simd<std::int64_t, abi_type> const& other)
       : m_value(static_cast<__m256i>(other)) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_uint64_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_uint64_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
     m_value = _mm256_maskload_epi64(reinterpret_cast<long long const*>(ptr),
                                     static_cast<__m256i>(mask_type(true)));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_maskstore_epi64(reinterpret_cast<long long*>(ptr),
+                           static_cast<__m256i>(mask_type(true)), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
   operator>>(unsigned int rhs) const {
     return _mm256_srli_epi64(m_value, rhs);
@@ -1029,6 +1067,14 @@ class const_where_expression<
     _mm_maskstore_epi32(mem, static_cast<__m128i>(m_mask),
                         static_cast<__m128i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::int32_t* mem,
+      simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) const {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      if (m_mask[lane]) mem[index[lane]] = m_value[lane];
+    }
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1056,6 +1102,14 @@ class where_expression<simd_mask<std::int32_t, simd_abi::avx2_fixed_size<4>>,
   void copy_from(std::int32_t const* mem, element_aligned_tag) {
     m_value = value_type(_mm_maskload_epi32(mem, static_cast<__m128i>(m_mask)));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::int32_t const* mem,
+      simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+    m_value = value_type(_mm_mask_i32gather_epi32(
+        _mm_set1_epi32(0), mem, static_cast<__m128i>(index),
+        static_cast<__m128i>(m_mask), 4));
+  }
   template <
       class U,
       std::enable_if_t<std::is_convertible_v<
@@ -1095,6 +1149,14 @@ class const_where_expression<
                            static_cast<__m256i>(m_mask),
                            static_cast<__m256i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::int64_t* mem,
+      simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) const {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      if (m_mask[lane]) mem[index[lane]] = m_value[lane];
+    }
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1123,6 +1185,14 @@ class where_expression<simd_mask<std::int64_t, simd_abi::avx2_fixed_size<4>>,
     m_value = value_type(_mm256_maskload_epi64(
         reinterpret_cast<long long const*>(mem), static_cast<__m256i>(m_mask)));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::int64_t const* mem,
+      simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+    m_value = value_type(_mm256_mask_i32gather_epi64(
+        _mm256_set1_epi64x(0), reinterpret_cast<long long const*>(mem),
+        static_cast<__m128i>(index), static_cast<__m256i>(m_mask), 8));
+  }
   template <
       class u,
       std::enable_if_t<std::is_convertible_v<
@@ -1163,6 +1233,14 @@ class const_where_expression<
                            static_cast<__m256i>(m_mask),
                            static_cast<__m256i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::uint64_t* mem,
+      simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) const {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      if (m_mask[lane]) mem[index[lane]] = m_value[lane];
+    }
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1191,6 +1269,14 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::avx2_fixed_size<4>>,
     m_value = value_type(_mm256_maskload_epi64(
         reinterpret_cast<long long const*>(mem), static_cast<__m256i>(m_mask)));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::uint64_t const* mem,
+      simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+    m_value = value_type(_mm256_mask_i32gather_epi64(
+        _mm256_set1_epi64x(0), reinterpret_cast<long long const*>(mem),
+        static_cast<__m128i>(index), static_cast<__m256i>(m_mask), 8));
+  }
   template <class u,
             std::enable_if_t<
                 std::is_convertible_v<
@@ -1208,6 +1294,898 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::avx2_fixed_size<4>>,
   }
 };
 
+namespace Impl {
+
+// horizontal reductions are implemented as log2(lanes) shuffle trees:
+// the upper half of the register is folded onto the lower half until
+// only one lane remains
+
+template <class BinaryOperation>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double avx2_hreduce_pd(
+    __m256d const& v, BinaryOperation op) {
+  __m128d r = op(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  r         = op(r, _mm_unpackhi_pd(r, r));
+  return _mm_cvtsd_f64(r);
+}
+
+template <class BinaryOperation>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t avx2_hreduce_epi32(
+    __m128i const& v, BinaryOperation op) {
+  __m128i r = op(v, _mm_unpackhi_epi64(v, v));
+  r         = op(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtsi128_si32(r);
+}
+
+template <class BinaryOperation>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t avx2_hreduce_epi64(
+    __m256i const& v, BinaryOperation op) {
+  __m128i r = op(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+  r         = op(r, _mm_unpackhi_epi64(r, r));
+  return _mm_cvtsi128_si64(r);
+}
+
+// AVX2 has no 64-bit integer min/max, so these are built on cmpgt + blend.
+// Unsigned comparisons flip the sign bit first.
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i avx2_min_epi64(__m128i const& a,
+                                                            __m128i const& b) {
+  return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i avx2_max_epi64(__m128i const& a,
+                                                            __m128i const& b) {
+  return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(a, b));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i
+avx2_cmpgt_epu64(__m128i const& a, __m128i const& b) {
+  __m128i const sign_bit =
+      _mm_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+  return _mm_cmpgt_epi64(_mm_xor_si128(a, sign_bit),
+                         _mm_xor_si128(b, sign_bit));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i avx2_min_epu64(__m128i const& a,
+                                                            __m128i const& b) {
+  return _mm_blendv_epi8(a, b, avx2_cmpgt_epu64(a, b));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i avx2_max_epu64(__m128i const& a,
+                                                            __m128i const& b) {
+  return _mm_blendv_epi8(b, a, avx2_cmpgt_epu64(a, b));
+}
+
+}  // namespace Impl
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::avx2_fixed_size<4>> const& v, std::plus<> = {}) {
+  return Impl::avx2_hreduce_pd(
+      static_cast<__m256d>(v),
+      [](__m128d const& a, __m128d const& b) { return _mm_add_pd(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::avx2_fixed_size<4>> const& v, std::multiplies<>) {
+  return Impl::avx2_hreduce_pd(
+      static_cast<__m256d>(v),
+      [](__m128d const& a, __m128d const& b) { return _mm_mul_pd(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmin(
+    simd<double, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_pd(
+      static_cast<__m256d>(v),
+      [](__m128d const& a, __m128d const& b) { return _mm_min_pd(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmax(
+    simd<double, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_pd(
+      static_cast<__m256d>(v),
+      [](__m128d const& a, __m128d const& b) { return _mm_max_pd(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::plus<> = {}) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_add_epi32(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::multiplies<>) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_mullo_epi32(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_and<>) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_and_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_or<>) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_or_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_xor<>) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_xor_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t hmin(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_min_epi32(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t hmax(
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_epi32(
+      static_cast<__m128i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_max_epi32(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::plus<> = {}) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_add_epi64(a, b); });
+}
+
+// AVX2 has no 64-bit multiply, so the lanes are extracted and multiplied
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::multiplies<>) {
+  __m256i const x = static_cast<__m256i>(v);
+  return std::int64_t(_mm256_extract_epi64(x, 0)) *
+         std::int64_t(_mm256_extract_epi64(x, 1)) *
+         std::int64_t(_mm256_extract_epi64(x, 2)) *
+         std::int64_t(_mm256_extract_epi64(x, 3));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_and<>) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_and_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_or<>) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_or_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_xor<>) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_xor_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t hmin(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_epi64(static_cast<__m256i>(v),
+                                  Impl::avx2_min_epi64);
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t hmax(
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_epi64(static_cast<__m256i>(v),
+                                  Impl::avx2_max_epi64);
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::plus<> = {}) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_add_epi64(a, b); });
+}
+
+// AVX2 has no 64-bit multiply, so the lanes are extracted and multiplied
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::multiplies<>) {
+  __m256i const x = static_cast<__m256i>(v);
+  return std::uint64_t(_mm256_extract_epi64(x, 0)) *
+         std::uint64_t(_mm256_extract_epi64(x, 1)) *
+         std::uint64_t(_mm256_extract_epi64(x, 2)) *
+         std::uint64_t(_mm256_extract_epi64(x, 3));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::bit_and<>) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_and_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v, std::bit_or<>) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_or_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v,
+    std::bit_xor<>) {
+  return Impl::avx2_hreduce_epi64(
+      static_cast<__m256i>(v),
+      [](__m128i const& a, __m128i const& b) { return _mm_xor_si128(a, b); });
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t hmin(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_epi64(static_cast<__m256i>(v),
+                                  Impl::avx2_min_epu64);
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t hmax(
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& v) {
+  return Impl::avx2_hreduce_epi64(static_cast<__m256i>(v),
+                                  Impl::avx2_max_epu64);
+}
+
+// masked reductions replace the inactive lanes with the identity element
+// using a single blend and then reuse the unmasked shuffle trees above
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmin(const_where_expression<simd_mask<T, simd_abi::avx2_fixed_size<4>>,
+                            simd<T, simd_abi::avx2_fixed_size<4>>> const& x) {
+  return hmin(condition(
+      x.impl_get_mask(), x.impl_get_value(),
+      simd<T, simd_abi::avx2_fixed_size<4>>(
+          Kokkos::reduction_identity<T>::min())));
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmax(const_where_expression<simd_mask<T, simd_abi::avx2_fixed_size<4>>,
+                            simd<T, simd_abi::avx2_fixed_size<4>>> const& x) {
+  return hmax(condition(
+      x.impl_get_mask(), x.impl_get_value(),
+      simd<T, simd_abi::avx2_fixed_size<4>>(
+          Kokkos::reduction_identity<T>::max())));
+}
+
+template <class T, class BinaryOperation>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+reduce(const_where_expression<simd_mask<T, simd_abi::avx2_fixed_size<4>>,
+                              simd<T, simd_abi::avx2_fixed_size<4>>> const& x,
+       T identity_element, BinaryOperation op) {
+  return reduce(
+      condition(x.impl_get_mask(), x.impl_get_value(),
+                simd<T, simd_abi::avx2_fixed_size<4>>(identity_element)),
+      op);
+}
+
+namespace Impl {
+
+// lane index tables for the 16 possible masks of a 4-lane vector:
+// compress[m] lists the lanes set in m in ascending order, expand[m] maps
+// every lane set in m to its rank among the set lanes, count[m] is the
+// number of set lanes
+struct avx2_lane_tables {
+  std::int32_t compress[16][4];
+  std::int32_t expand[16][4];
+  std::int32_t count[16];
+  constexpr avx2_lane_tables() : compress(), expand(), count() {
+    for (int mask = 0; mask < 16; ++mask) {
+      for (int lane = 0; lane < 4; ++lane) {
+        if (mask & (1 << lane)) {
+          compress[mask][count[mask]] = lane;
+          expand[mask][lane]          = count[mask]++;
+        }
+      }
+    }
+  }
+};
+
+inline constexpr avx2_lane_tables avx2_lane_table{};
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i
+avx2_load_lanes(std::int32_t const (&lanes)[4]) {
+  return _mm_loadu_si128(reinterpret_cast<__m128i const*>(lanes));
+}
+
+// mask of the lowest count lanes
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i avx2_low_lanes_epi32(int count) {
+  return _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256i avx2_low_lanes_epi64(int count) {
+  return _mm256_cmpgt_epi64(_mm256_set1_epi64x(count),
+                            _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i
+avx2_permute_epi32(__m128i const& a, __m128i const& index) {
+  return _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(a), index));
+}
+
+// AVX2 only permutes 32-bit elements across the full register, so each
+// 64-bit lane index i becomes the pair of 32-bit indices (2i, 2i+1)
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256i
+avx2_permute_epi64(__m256i const& a, __m128i const& index) {
+  __m256i const low = _mm256_slli_epi64(_mm256_cvtepi32_epi64(index), 1);
+  __m256i const high =
+      _mm256_slli_epi64(_mm256_add_epi64(low, _mm256_set1_epi64x(1)), 32);
+  return _mm256_permutevar8x32_epi32(a, _mm256_or_si256(low, high));
+}
+
+}  // namespace Impl
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>>
+    permute(simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& a,
+            simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<4>>(
+      Impl::avx2_permute_epi32(static_cast<__m128i>(a),
+                               static_cast<__m128i>(index)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>>
+    compress(simd_mask<std::int32_t, simd_abi::avx2_fixed_size<4>> const& mask,
+             simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits =
+      _mm_movemask_ps(_mm_castsi128_ps(static_cast<__m128i>(mask)));
+  __m128i const packed = Impl::avx2_permute_epi32(
+      static_cast<__m128i>(a),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.compress[bits]));
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<4>>(_mm_and_si128(
+      packed, Impl::avx2_low_lanes_epi32(Impl::avx2_lane_table.count[bits])));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>>
+    expand(simd_mask<std::int32_t, simd_abi::avx2_fixed_size<4>> const& mask,
+           simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits =
+      _mm_movemask_ps(_mm_castsi128_ps(static_cast<__m128i>(mask)));
+  __m128i const spread = Impl::avx2_permute_epi32(
+      static_cast<__m128i>(a),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.expand[bits]));
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<4>>(
+      _mm_and_si128(spread, static_cast<__m128i>(mask)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::int32_t, simd_abi::avx2_fixed_size<4>> const& mask,
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& a,
+    std::int32_t* mem) {
+  int const bits =
+      _mm_movemask_ps(_mm_castsi128_ps(static_cast<__m128i>(mask)));
+  int const count = Impl::avx2_lane_table.count[bits];
+  _mm_maskstore_epi32(mem, Impl::avx2_low_lanes_epi32(count),
+                      static_cast<__m128i>(compress(mask, a)));
+  return count;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    permute(simd<double, simd_abi::avx2_fixed_size<4>> const& a,
+            simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+  return simd<double, simd_abi::avx2_fixed_size<4>>(
+      _mm256_castsi256_pd(Impl::avx2_permute_epi64(
+          _mm256_castpd_si256(static_cast<__m256d>(a)),
+          static_cast<__m128i>(index))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    compress(simd_mask<double, simd_abi::avx2_fixed_size<4>> const& mask,
+             simd<double, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits       = _mm256_movemask_pd(static_cast<__m256d>(mask));
+  __m256i const packed = Impl::avx2_permute_epi64(
+      _mm256_castpd_si256(static_cast<__m256d>(a)),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.compress[bits]));
+  return simd<double, simd_abi::avx2_fixed_size<4>>(
+      _mm256_castsi256_pd(_mm256_and_si256(
+          packed,
+          Impl::avx2_low_lanes_epi64(Impl::avx2_lane_table.count[bits]))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    expand(simd_mask<double, simd_abi::avx2_fixed_size<4>> const& mask,
+           simd<double, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits       = _mm256_movemask_pd(static_cast<__m256d>(mask));
+  __m256i const spread = Impl::avx2_permute_epi64(
+      _mm256_castpd_si256(static_cast<__m256d>(a)),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.expand[bits]));
+  return simd<double, simd_abi::avx2_fixed_size<4>>(
+      _mm256_and_pd(_mm256_castsi256_pd(spread), static_cast<__m256d>(mask)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<double, simd_abi::avx2_fixed_size<4>> const& mask,
+    simd<double, simd_abi::avx2_fixed_size<4>> const& a, double* mem) {
+  int const bits  = _mm256_movemask_pd(static_cast<__m256d>(mask));
+  int const count = Impl::avx2_lane_table.count[bits];
+  _mm256_maskstore_pd(mem, Impl::avx2_low_lanes_epi64(count),
+                      static_cast<__m256d>(compress(mask, a)));
+  return count;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>>
+    permute(simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& a,
+            simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+  return simd<std::int64_t, simd_abi::avx2_fixed_size<4>>(
+      Impl::avx2_permute_epi64(static_cast<__m256i>(a),
+                               static_cast<__m128i>(index)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>>
+    compress(simd_mask<std::int64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+             simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits =
+      _mm256_movemask_pd(_mm256_castsi256_pd(static_cast<__m256i>(mask)));
+  __m256i const packed = Impl::avx2_permute_epi64(
+      static_cast<__m256i>(a),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.compress[bits]));
+  return simd<std::int64_t, simd_abi::avx2_fixed_size<4>>(_mm256_and_si256(
+      packed, Impl::avx2_low_lanes_epi64(Impl::avx2_lane_table.count[bits])));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>>
+    expand(simd_mask<std::int64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+           simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits =
+      _mm256_movemask_pd(_mm256_castsi256_pd(static_cast<__m256i>(mask)));
+  __m256i const spread = Impl::avx2_permute_epi64(
+      static_cast<__m256i>(a),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.expand[bits]));
+  return simd<std::int64_t, simd_abi::avx2_fixed_size<4>>(
+      _mm256_and_si256(spread, static_cast<__m256i>(mask)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::int64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& a,
+    std::int64_t* mem) {
+  int const bits =
+      _mm256_movemask_pd(_mm256_castsi256_pd(static_cast<__m256i>(mask)));
+  int const count = Impl::avx2_lane_table.count[bits];
+  _mm256_maskstore_epi64(reinterpret_cast<long long*>(mem),
+                         Impl::avx2_low_lanes_epi64(count),
+                         static_cast<__m256i>(compress(mask, a)));
+  return count;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>>
+    permute(simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& a,
+            simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& index) {
+  return simd<std::uint64_t, simd_abi::avx2_fixed_size<4>>(
+      Impl::avx2_permute_epi64(static_cast<__m256i>(a),
+                               static_cast<__m128i>(index)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>>
+    compress(simd_mask<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+             simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits =
+      _mm256_movemask_pd(_mm256_castsi256_pd(static_cast<__m256i>(mask)));
+  __m256i const packed = Impl::avx2_permute_epi64(
+      static_cast<__m256i>(a),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.compress[bits]));
+  return simd<std::uint64_t, simd_abi::avx2_fixed_size<4>>(_mm256_and_si256(
+      packed, Impl::avx2_low_lanes_epi64(Impl::avx2_lane_table.count[bits])));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>>
+    expand(simd_mask<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+           simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& a) {
+  int const bits =
+      _mm256_movemask_pd(_mm256_castsi256_pd(static_cast<__m256i>(mask)));
+  __m256i const spread = Impl::avx2_permute_epi64(
+      static_cast<__m256i>(a),
+      Impl::avx2_load_lanes(Impl::avx2_lane_table.expand[bits]));
+  return simd<std::uint64_t, simd_abi::avx2_fixed_size<4>>(
+      _mm256_and_si256(spread, static_cast<__m256i>(mask)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+    simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> const& a,
+    std::uint64_t* mem) {
+  int const bits =
+      _mm256_movemask_pd(_mm256_castsi256_pd(static_cast<__m256i>(mask)));
+  int const count = Impl::avx2_lane_table.count[bits];
+  _mm256_maskstore_epi64(reinterpret_cast<long long*>(mem),
+                         Impl::avx2_low_lanes_epi64(count),
+                         static_cast<__m256i>(compress(mask, a)));
+  return count;
+}
+
+// simd<Kokkos::complex<double>> keeps the lanes in the interleaved
+// (real, imag) layout of Kokkos::complex so that loads and stores from
+// complex arrays are plain vector moves: lanes 0 and 1 live in m_low and
+// lanes 2 and 3 in m_high
+
+namespace Impl {
+
+// (a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re) for each complex
+// pair of the registers, using fmaddsub to subtract in the even and add in
+// the odd elements
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d
+avx2_complex_mul(__m256d const& a, __m256d const& b) {
+  __m256d const a_real    = _mm256_movedup_pd(a);
+  __m256d const a_imag    = _mm256_permute_pd(a, 0xF);
+  __m256d const b_swapped = _mm256_permute_pd(b, 0x5);
+  return _mm256_fmaddsub_pd(a_real, b, _mm256_mul_pd(a_imag, b_swapped));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d
+avx2_complex_conj(__m256d const& a) {
+  return _mm256_xor_pd(a, _mm256_setr_pd(0.0, -0.0, 0.0, -0.0));
+}
+
+// re * re + im * im broadcast to both elements of each complex pair
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d
+avx2_complex_norm(__m256d const& a) {
+  __m256d const squares = _mm256_mul_pd(a, a);
+  return _mm256_add_pd(squares, _mm256_permute_pd(squares, 0x5));
+}
+
+// a / b like Kokkos::complex: both are scaled by |b.re| + |b.im| so that the
+// norm of b neither overflows nor underflows, and a zero b gives a / 0
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d
+avx2_complex_div(__m256d const& a, __m256d const& b) {
+  __m256d const abs_b    = _mm256_andnot_pd(_mm256_set1_pd(-0.0), b);
+  __m256d const scale    = _mm256_add_pd(abs_b, _mm256_permute_pd(abs_b, 0x5));
+  __m256d const a_scaled = _mm256_div_pd(a, scale);
+  __m256d const b_scaled = _mm256_div_pd(b, scale);
+  __m256d const quotient =
+      _mm256_div_pd(avx2_complex_mul(a_scaled, avx2_complex_conj(b_scaled)),
+                    avx2_complex_norm(b_scaled));
+  return _mm256_blendv_pd(
+      quotient, a_scaled,
+      _mm256_cmp_pd(scale, _mm256_setzero_pd(), _CMP_EQ_OQ));
+}
+
+// the masks of the doubles of the complex lanes 0 and 1 (low) or 2 and 3
+// (high), each lane mask repeated for its real and imaginary parts
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d
+avx2_complex_low_mask(__m256d const& mask) {
+  return _mm256_permute4x64_pd(mask, _MM_SHUFFLE(1, 1, 0, 0));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d
+avx2_complex_high_mask(__m256d const& mask) {
+  return _mm256_permute4x64_pd(mask, _MM_SHUFFLE(3, 3, 2, 2));
+}
+
+}  // namespace Impl
+
+template <>
+class simd_mask<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> {
+  __m256d m_value;
+
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using reference  = simd_mask<double, abi_type>::reference;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(value_type value)
+      : m_value(_mm256_castsi256_pd(_mm256_set1_epi64x(-std::int64_t(value)))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(
+      simd_mask<double, abi_type> const& other)
+      : m_value(static_cast<__m256d>(other)) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit simd_mask(
+      __m256d const& value_in)
+      : m_value(value_in) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256d()
+      const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return static_cast<value_type>(
+        reference(const_cast<__m256d&>(m_value), int(i)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator||(simd_mask const& other) const {
+    return simd_mask(_mm256_or_pd(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator&&(simd_mask const& other) const {
+    return simd_mask(_mm256_and_pd(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    auto const true_value = static_cast<__m256d>(simd_mask(true));
+    return simd_mask(_mm256_andnot_pd(m_value, true_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      simd_mask const& other) const {
+    return _mm256_movemask_pd(m_value) == _mm256_movemask_pd(other.m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      simd_mask const& other) const {
+    return !operator==(other);
+  }
+};
+
+template <>
+class simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> {
+  __m256d m_low;
+  __m256d m_high;
+
+ public:
+  using value_type = Kokkos::complex<double>;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd&&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value) {
+    value_type const v(value);
+    m_low  = _mm256_setr_pd(v.real(), v.imag(), v.real(), v.imag());
+    m_high = m_low;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(
+      simd<double, abi_type> const& real_part,
+      simd<double, abi_type> const& imag_part) {
+    __m256d const low  = _mm256_unpacklo_pd(static_cast<__m256d>(real_part),
+                                           static_cast<__m256d>(imag_part));
+    __m256d const high = _mm256_unpackhi_pd(static_cast<__m256d>(real_part),
+                                            static_cast<__m256d>(imag_part));
+    m_low  = _mm256_permute2f128_pd(low, high, 0x20);
+    m_high = _mm256_permute2f128_pd(low, high, 0x31);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr simd(__m256d const& low,
+                                                       __m256d const& high)
+      : m_low(low), m_high(high) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    double values[8];
+    _mm256_storeu_pd(values, m_low);
+    _mm256_storeu_pd(values + 4, m_high);
+    return value_type(values[2 * i], values[2 * i + 1]);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_low  = _mm256_loadu_pd(reinterpret_cast<double const*>(ptr));
+    m_high = _mm256_loadu_pd(reinterpret_cast<double const*>(ptr + 2));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_storeu_pd(reinterpret_cast<double*>(ptr), m_low);
+    _mm256_storeu_pd(reinterpret_cast<double*>(ptr + 2), m_high);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_low  = _mm256_load_pd(reinterpret_cast<double const*>(ptr));
+    m_high = _mm256_load_pd(reinterpret_cast<double const*>(ptr + 2));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm256_store_pd(reinterpret_cast<double*>(ptr), m_low);
+    _mm256_store_pd(reinterpret_cast<double*>(ptr + 2), m_high);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d impl_get_low() const {
+    return m_low;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256d impl_get_high() const {
+    return m_high;
+  }
+};
+
+template <>
+class const_where_expression<
+    simd_mask<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>,
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>> {
+ public:
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using value_type = simd<Kokkos::complex<double>, abi_type>;
+  using mask_type  = simd_mask<Kokkos::complex<double>, abi_type>;
+
+ protected:
+  value_type& m_value;
+  mask_type const& m_mask;
+
+ public:
+  const_where_expression(mask_type const& mask_arg, value_type const& value_arg)
+      : m_value(const_cast<value_type&>(value_arg)), m_mask(mask_arg) {}
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(Kokkos::complex<double>* mem, element_aligned_tag) const {
+    __m256d const mask = static_cast<__m256d>(m_mask);
+    _mm256_maskstore_pd(
+        reinterpret_cast<double*>(mem),
+        _mm256_castpd_si256(Impl::avx2_complex_low_mask(mask)),
+        m_value.impl_get_low());
+    _mm256_maskstore_pd(
+        reinterpret_cast<double*>(mem + 2),
+        _mm256_castpd_si256(Impl::avx2_complex_high_mask(mask)),
+        m_value.impl_get_high());
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
+  impl_get_value() const {
+    return m_value;
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type const&
+  impl_get_mask() const {
+    return m_mask;
+  }
+};
+
+template <>
+class where_expression<
+    simd_mask<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>,
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>>
+    : public const_where_expression<
+          simd_mask<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>,
+          simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>> {
+ public:
+  where_expression(mask_type const& mask_arg, value_type& value_arg)
+      : const_where_expression(mask_arg, value_arg) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(Kokkos::complex<double> const* mem, element_aligned_tag) {
+    __m256d const mask = static_cast<__m256d>(m_mask);
+    __m256d const low  = _mm256_maskload_pd(
+        reinterpret_cast<double const*>(mem),
+        _mm256_castpd_si256(Impl::avx2_complex_low_mask(mask)));
+    __m256d const high = _mm256_maskload_pd(
+        reinterpret_cast<double const*>(mem + 2),
+        _mm256_castpd_si256(Impl::avx2_complex_high_mask(mask)));
+    m_value = value_type(low, high);
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void operator=(U&& x) {
+    auto const x_as_value_type = static_cast<value_type>(std::forward<U>(x));
+    __m256d const mask         = static_cast<__m256d>(m_mask);
+    __m256d const low          = _mm256_blendv_pd(
+        m_value.impl_get_low(), x_as_value_type.impl_get_low(),
+        Impl::avx2_complex_low_mask(mask));
+    __m256d const high         = _mm256_blendv_pd(
+        m_value.impl_get_high(), x_as_value_type.impl_get_high(),
+        Impl::avx2_complex_high_mask(mask));
+    m_value = value_type(low, high);
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>
+    operator+(
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>(
+      _mm256_add_pd(lhs.impl_get_low(), rhs.impl_get_low()),
+      _mm256_add_pd(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>
+    operator-(
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>(
+      _mm256_sub_pd(lhs.impl_get_low(), rhs.impl_get_low()),
+      _mm256_sub_pd(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>
+    operator-(
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const& a) {
+  __m256d const zero = _mm256_setzero_pd();
+  return simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>(
+      _mm256_sub_pd(zero, a.impl_get_low()),
+      _mm256_sub_pd(zero, a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>
+    operator*(
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>(
+      Impl::avx2_complex_mul(lhs.impl_get_low(), rhs.impl_get_low()),
+      Impl::avx2_complex_mul(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>
+    operator/(
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>(
+      Impl::avx2_complex_div(lhs.impl_get_low(), rhs.impl_get_low()),
+      Impl::avx2_complex_div(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>
+    conj(simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+             a) {
+  return simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>>(
+      Impl::avx2_complex_conj(a.impl_get_low()),
+      Impl::avx2_complex_conj(a.impl_get_high()));
+}
+
+// _mm256_unpack*_pd and _mm256_hadd_pd work within 128-bit halves and leave
+// the lanes in the order 0, 2, 1, 3, which the final permute restores
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    real(simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+             a) {
+  return simd<double, simd_abi::avx2_fixed_size<4>>(_mm256_permute4x64_pd(
+      _mm256_unpacklo_pd(a.impl_get_low(), a.impl_get_high()),
+      _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    imag(simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+             a) {
+  return simd<double, simd_abi::avx2_fixed_size<4>>(_mm256_permute4x64_pd(
+      _mm256_unpackhi_pd(a.impl_get_low(), a.impl_get_high()),
+      _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    norm(simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+             a) {
+  __m256d const low  = _mm256_mul_pd(a.impl_get_low(), a.impl_get_low());
+  __m256d const high = _mm256_mul_pd(a.impl_get_high(), a.impl_get_high());
+  return simd<double, simd_abi::avx2_fixed_size<4>>(_mm256_permute4x64_pd(
+      _mm256_hadd_pd(low, high), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    abs(simd<Kokkos::complex<double>, simd_abi::avx2_fixed_size<4>> const&
+            a) {
+  return Impl::complex_abs(real(a), imag(a));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
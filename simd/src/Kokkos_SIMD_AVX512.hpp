@@ -25,6 +25,22 @@
 
 #include <immintrin.h>
 
+// The GCC implementations of many unmasked AVX-512 intrinsics pass the result
+// of _mm512_undefined_* as the ignored source of the masked builtins, which
+// GCC then reports as uninitialized wherever they are inlined. Only the
+// functions using such intrinsics are enclosed in these macros.
+#if defined(KOKKOS_COMPILER_GNU)
+#define KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH                \
+  _Pragma("GCC diagnostic push")                                    \
+      _Pragma("GCC diagnostic ignored \"-Wuninitialized\"")         \
+          _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP \
+  _Pragma("GCC diagnostic pop")
+#else
+#define KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+#define KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+#endif
+
 namespace Kokkos {
 namespace Experimental {
 
@@ -35,6 +51,18 @@ class avx512_fixed_size {};
 
 }  // namespace simd_abi
 
+namespace Impl {
+
+// sign extends the 32-bit lanes of an index or shift count to 64 bits
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512i
+avx512_cvtepi32_epi64(__m256i const& a) {
+  return _mm512_cvtepi32_epi64(a);
+}
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+}  // namespace Impl
+
 template <class T>
 class simd_mask<T, simd_abi::avx512_fixed_size<8>> {
   __mmask8 m_value;
@@ -120,7 +148,7 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::int32_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_int32_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -156,11 +184,11 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<8>> {
                               gen(std::integral_constant<std::size_t, 6>()),
                               gen(std::integral_constant<std::size_t, 7>()))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int32_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int32_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
       value_type* ptr, element_aligned_tag) const {
@@ -172,6 +200,14 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<8>> {
     m_value = _mm256_mask_loadu_epi32(
         _mm256_set1_epi32(0), static_cast<__mmask8>(mask_type(true)), ptr);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256i()
       const {
     return m_value;
@@ -250,7 +286,7 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::uint32_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_uint32_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -271,11 +307,11 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> {
       simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& other)
       : m_value(static_cast<__m256i>(other)) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_uint32_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_uint32_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
       value_type* ptr, element_aligned_tag) const {
@@ -287,6 +323,14 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> {
     m_value = _mm256_mask_loadu_epi32(
         _mm256_set1_epi32(0), static_cast<__mmask8>(mask_type(true)), ptr);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256i()
       const {
     return m_value;
@@ -359,7 +403,7 @@ class simd<std::int64_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::int64_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_int64_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -374,17 +418,17 @@ class simd<std::int64_t, simd_abi::avx512_fixed_size<8>> {
       : m_value(_mm512_set1_epi64(value_type(value))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
       simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& other)
-      : m_value(_mm512_cvtepi32_epi64(static_cast<__m256i>(other))) {}
+      : m_value(Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(other))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
       simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& other);
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr simd(__m512i const& value_in)
       : m_value(value_in) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int64_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_int64_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -394,21 +438,29 @@ class simd<std::int64_t, simd_abi::avx512_fixed_size<8>> {
       value_type* ptr, element_aligned_tag) const {
     _mm512_storeu_si512(ptr, m_value);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm512_load_si512(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm512_store_si512(ptr, m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator>>(int rhs) const {
     return _mm512_srai_epi64(m_value, rhs);
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
   operator>>(simd<int, simd_abi::avx512_fixed_size<8>> const& rhs) const {
-    return _mm512_srav_epi64(m_value,
-                             _mm512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
+    return _mm512_srav_epi64(
+        m_value, Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator<<(int rhs) const {
     return _mm512_slli_epi64(m_value, rhs);
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
   operator<<(simd<int, simd_abi::avx512_fixed_size<8>> const& rhs) const {
-    return _mm512_sllv_epi64(m_value,
-                             _mm512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
+    return _mm512_sllv_epi64(
+        m_value, Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m512i()
       const {
@@ -488,7 +540,7 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::uint64_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::may_alias_uint64_t&;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
@@ -506,16 +558,16 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
       : m_value(value_in) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
       simd<std::int32_t, abi_type> const& other)
-      : m_value(_mm512_cvtepi32_epi64(static_cast<__m256i>(other))) {}
+      : m_value(Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(other))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
       simd<std::int64_t, abi_type> const& other)
       : m_value(static_cast<__m512i>(other)) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_uint64_t*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reinterpret_cast<Impl::may_alias_uint64_t const*>(&m_value)[i];
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -525,14 +577,22 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
       value_type* ptr, element_aligned_tag) const {
     _mm512_storeu_si512(ptr, m_value);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm512_load_si512(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm512_store_si512(ptr, m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
   operator>>(unsigned int rhs) const {
     return _mm512_srli_epi64(m_value, rhs);
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator>>(
       simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& rhs) const {
-    return _mm512_srlv_epi64(m_value,
-                             _mm512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
+    return _mm512_srlv_epi64(
+        m_value, Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
   operator<<(unsigned int rhs) const {
@@ -540,8 +600,8 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator<<(
       simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& rhs) const {
-    return _mm512_sllv_epi64(m_value,
-                             _mm512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
+    return _mm512_sllv_epi64(
+        m_value, Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(rhs)));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
   operator&(simd const& other) const {
@@ -615,10 +675,12 @@ simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> condition(
                               static_cast<__m512i>(b)));
 }
 
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
 KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
 simd<std::int32_t, simd_abi::avx512_fixed_size<8>>::simd(
     simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& other)
     : m_value(_mm512_cvtepi64_epi32(static_cast<__m512i>(other))) {}
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
 
 KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
 simd<std::int64_t, simd_abi::avx512_fixed_size<8>>::simd(
@@ -664,6 +726,14 @@ class simd<double, simd_abi::avx512_fixed_size<8>> {
       value_type* ptr, element_aligned_tag) const {
     _mm512_storeu_pd(ptr, m_value);
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm512_load_pd(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm512_store_pd(ptr, m_value);
+  }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m512d()
       const {
     return m_value;
@@ -756,12 +826,14 @@ simd<double, simd_abi::avx512_fixed_size<8>> abs(
                        reinterpret_cast<__m512i>(rhs))));
 }
 
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
 KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
 simd<double, simd_abi::avx512_fixed_size<8>> sqrt(
     simd<double, simd_abi::avx512_fixed_size<8>> const& a) {
   return simd<double, simd_abi::avx512_fixed_size<8>>(
       _mm512_sqrt_pd(static_cast<__m512d>(a)));
 }
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
 
 #ifdef __INTEL_COMPILER
 
@@ -798,6 +870,7 @@ simd<double, simd_abi::avx512_fixed_size<8>> fma(
                       static_cast<__m512d>(c)));
 }
 
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
 KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
 simd<double, simd_abi::avx512_fixed_size<8>> max(
     simd<double, simd_abi::avx512_fixed_size<8>> const& a,
@@ -813,6 +886,7 @@ simd<double, simd_abi::avx512_fixed_size<8>> min(
   return simd<double, simd_abi::avx512_fixed_size<8>>(
       _mm512_min_pd(static_cast<__m512d>(a), static_cast<__m512d>(b)));
 }
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
 
 KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
 simd<double, simd_abi::avx512_fixed_size<8>> condition(
@@ -846,6 +920,11 @@ class const_where_expression<simd_mask<double, simd_abi::avx512_fixed_size<8>>,
                           static_cast<__m512d>(m_value));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(double* mem, vector_aligned_tag) const {
+    _mm512_mask_store_pd(mem, static_cast<__mmask8>(m_mask),
+                         static_cast<__m512d>(m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
   void scatter_to(
       double* mem,
       simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) const {
@@ -882,6 +961,11 @@ class where_expression<simd_mask<double, simd_abi::avx512_fixed_size<8>>,
         _mm512_set1_pd(0.0), static_cast<__mmask8>(m_mask), mem));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(double const* mem, vector_aligned_tag) {
+    m_value = value_type(_mm512_mask_load_pd(
+        _mm512_set1_pd(0.0), static_cast<__mmask8>(m_mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
   void gather_from(
       double const* mem,
       simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
@@ -925,6 +1009,19 @@ class const_where_expression<
     _mm256_mask_storeu_epi32(mem, static_cast<__mmask8>(m_mask),
                              static_cast<__m256i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(std::int32_t* mem, vector_aligned_tag) const {
+    _mm256_mask_store_epi32(mem, static_cast<__mmask8>(m_mask),
+                            static_cast<__m256i>(m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::int32_t* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) const {
+    _mm256_mask_i32scatter_epi32(mem, static_cast<__mmask8>(m_mask),
+                                 static_cast<__m256i>(index),
+                                 static_cast<__m256i>(m_value), 4);
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -953,6 +1050,19 @@ class where_expression<simd_mask<std::int32_t, simd_abi::avx512_fixed_size<8>>,
     m_value = value_type(_mm256_mask_loadu_epi32(
         _mm256_set1_epi32(0), static_cast<__mmask8>(m_mask), mem));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(std::int32_t const* mem, vector_aligned_tag) {
+    m_value = value_type(_mm256_mask_load_epi32(
+        _mm256_set1_epi32(0), static_cast<__mmask8>(m_mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::int32_t const* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+    m_value = value_type(_mm256_mmask_i32gather_epi32(
+        _mm256_set1_epi32(0), static_cast<__mmask8>(m_mask),
+        static_cast<__m256i>(index), mem, 4));
+  }
   template <class U,
             std::enable_if_t<
                 std::is_convertible_v<
@@ -991,6 +1101,19 @@ class const_where_expression<
     _mm256_mask_storeu_epi32(mem, static_cast<__mmask8>(m_mask),
                              static_cast<__m256i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(std::uint32_t* mem, vector_aligned_tag) const {
+    _mm256_mask_store_epi32(mem, static_cast<__mmask8>(m_mask),
+                            static_cast<__m256i>(m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::uint32_t* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) const {
+    _mm256_mask_i32scatter_epi32(mem, static_cast<__mmask8>(m_mask),
+                                 static_cast<__m256i>(index),
+                                 static_cast<__m256i>(m_value), 4);
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1019,6 +1142,19 @@ class where_expression<simd_mask<std::uint32_t, simd_abi::avx512_fixed_size<8>>,
     m_value = value_type(_mm256_mask_loadu_epi32(
         _mm256_set1_epi32(0), static_cast<__mmask8>(m_mask), mem));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(std::uint32_t const* mem, vector_aligned_tag) {
+    m_value = value_type(_mm256_mask_load_epi32(
+        _mm256_set1_epi32(0), static_cast<__mmask8>(m_mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::uint32_t const* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+    m_value = value_type(_mm256_mmask_i32gather_epi32(
+        _mm256_set1_epi32(0), static_cast<__mmask8>(m_mask),
+        static_cast<__m256i>(index), mem, 4));
+  }
   template <class U,
             std::enable_if_t<
                 std::is_convertible_v<
@@ -1057,6 +1193,19 @@ class const_where_expression<
     _mm512_mask_storeu_epi64(mem, static_cast<__mmask8>(m_mask),
                              static_cast<__m512i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(std::int64_t* mem, vector_aligned_tag) const {
+    _mm512_mask_store_epi64(mem, static_cast<__mmask8>(m_mask),
+                            static_cast<__m512i>(m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::int64_t* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) const {
+    _mm512_mask_i32scatter_epi64(mem, static_cast<__mmask8>(m_mask),
+                                 static_cast<__m256i>(index),
+                                 static_cast<__m512i>(m_value), 8);
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1085,6 +1234,19 @@ class where_expression<simd_mask<std::int64_t, simd_abi::avx512_fixed_size<8>>,
     m_value = value_type(_mm512_mask_loadu_epi64(
         _mm512_set1_epi64(0.0), static_cast<__mmask8>(m_mask), mem));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(std::int64_t const* mem, vector_aligned_tag) {
+    m_value = value_type(_mm512_mask_load_epi64(
+        _mm512_set1_epi64(0), static_cast<__mmask8>(m_mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::int64_t const* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+    m_value = value_type(_mm512_mask_i32gather_epi64(
+        _mm512_set1_epi64(0), static_cast<__mmask8>(m_mask),
+        static_cast<__m256i>(index), mem, 8));
+  }
   template <class U,
             std::enable_if_t<
                 std::is_convertible_v<
@@ -1123,6 +1285,19 @@ class const_where_expression<
     _mm512_mask_storeu_epi64(mem, static_cast<__mmask8>(m_mask),
                              static_cast<__m512i>(m_value));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(std::uint64_t* mem, vector_aligned_tag) const {
+    _mm512_mask_store_epi64(mem, static_cast<__mmask8>(m_mask),
+                            static_cast<__m512i>(m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::uint64_t* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) const {
+    _mm512_mask_i32scatter_epi64(mem, static_cast<__mmask8>(m_mask),
+                                 static_cast<__m256i>(index),
+                                 static_cast<__m512i>(m_value), 8);
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1151,6 +1326,19 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::avx512_fixed_size<8>>,
     m_value = value_type(_mm512_mask_loadu_epi64(
         _mm512_set1_epi64(0.0), static_cast<__mmask8>(m_mask), mem));
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(std::uint64_t const* mem, vector_aligned_tag) {
+    m_value = value_type(_mm512_mask_load_epi64(
+        _mm512_set1_epi64(0), static_cast<__mmask8>(m_mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::uint64_t const* mem,
+      simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+    m_value = value_type(_mm512_mask_i32gather_epi64(
+        _mm512_set1_epi64(0), static_cast<__mmask8>(m_mask),
+        static_cast<__m256i>(index), mem, 8));
+  }
   template <class U,
             std::enable_if_t<
                 std::is_convertible_v<
@@ -1167,42 +1355,796 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::avx512_fixed_size<8>>,
   }
 };
 
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+
+namespace Impl {
+
+// AVX-512 has no native xor reduction, so that one is done as a shuffle
+// tree folding the upper half of the register onto the lower half
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t avx512_hreduce_xor_epi32(
+    __m256i const& v) {
+  __m128i r = _mm_xor_si128(_mm256_castsi256_si128(v),
+                            _mm256_extracti128_si256(v, 1));
+  r         = _mm_xor_si128(r, _mm_unpackhi_epi64(r, r));
+  r         = _mm_xor_si128(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtsi128_si32(r);
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t avx512_hreduce_xor_epi64(
+    __m512i const& v) {
+  __m256i const r256 = _mm256_xor_si256(_mm512_castsi512_si256(v),
+                                        _mm512_extracti64x4_epi64(v, 1));
+  __m128i r          = _mm_xor_si128(_mm256_castsi256_si128(r256),
+                                     _mm256_extracti128_si256(r256, 1));
+  r                  = _mm_xor_si128(r, _mm_unpackhi_epi64(r, r));
+  return _mm_cvtsi128_si64(r);
+}
+
+}  // namespace Impl
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::plus<> = {}) {
+  return _mm512_mask_reduce_add_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::multiplies<>) {
+  return _mm512_mask_reduce_mul_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_and<>) {
+  return _mm512_mask_reduce_and_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_or<>) {
+  return _mm512_mask_reduce_or_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t hmin(
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_mask_reduce_min_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
 [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t hmax(
-    const_where_expression<
-        simd_mask<std::int32_t, simd_abi::avx512_fixed_size<8>>,
-        simd<std::int32_t, simd_abi::avx512_fixed_size<8>>> const& x) {
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v) {
   return _mm512_mask_reduce_max_epi32(
-      static_cast<__mmask8>(x.impl_get_mask()),
-      _mm512_castsi256_si512(static_cast<__m256i>(x.impl_get_value())));
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
 }
 
-[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmin(
-    const_where_expression<simd_mask<double, simd_abi::avx512_fixed_size<8>>,
-                           simd<double, simd_abi::avx512_fixed_size<8>>> const&
-        x) {
-  return _mm512_mask_reduce_min_pd(static_cast<__mmask8>(x.impl_get_mask()),
-                                   static_cast<__m512d>(x.impl_get_value()));
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t reduce(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::plus<> = {}) {
+  return _mm512_mask_reduce_add_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t reduce(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::multiplies<>) {
+  return _mm512_mask_reduce_mul_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t reduce(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_and<>) {
+  return _mm512_mask_reduce_and_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t reduce(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_or<>) {
+  return _mm512_mask_reduce_or_epi32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t hmin(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_mask_reduce_min_epu32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t hmax(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_mask_reduce_max_epu32(
+      __mmask8(0xFF), _mm512_castsi256_si512(static_cast<__m256i>(v)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::plus<> = {}) {
+  return _mm512_reduce_add_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::multiplies<>) {
+  return _mm512_reduce_mul_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_and<>) {
+  return _mm512_reduce_and_epi64(static_cast<__m512i>(v));
 }
 
 [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
-    const_where_expression<
-        simd_mask<std::int64_t, simd_abi::avx512_fixed_size<8>>,
-        simd<std::int64_t, simd_abi::avx512_fixed_size<8>>> const& x,
-    std::int64_t, std::plus<>) {
-  return _mm512_mask_reduce_add_epi64(static_cast<__mmask8>(x.impl_get_mask()),
-                                      static_cast<__m512i>(x.impl_get_value()));
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_or<>) {
+  return _mm512_reduce_or_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t hmin(
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_reduce_min_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t hmax(
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_reduce_max_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::plus<> = {}) {
+  return _mm512_reduce_add_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::multiplies<>) {
+  return _mm512_reduce_mul_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_and<>) {
+  return _mm512_reduce_and_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_or<>) {
+  return _mm512_reduce_or_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t hmin(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_reduce_min_epu64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t hmax(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_reduce_max_epu64(static_cast<__m512i>(v));
 }
 
 [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double reduce(
-    const_where_expression<simd_mask<double, simd_abi::avx512_fixed_size<8>>,
-                           simd<double, simd_abi::avx512_fixed_size<8>>> const&
-        x,
-    double, std::plus<>) {
-  return _mm512_mask_reduce_add_pd(static_cast<__mmask8>(x.impl_get_mask()),
-                                   static_cast<__m512d>(x.impl_get_value()));
+    simd<double, simd_abi::avx512_fixed_size<8>> const& v, std::plus<> = {}) {
+  return _mm512_reduce_add_pd(static_cast<__m512d>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::avx512_fixed_size<8>> const& v, std::multiplies<>) {
+  return _mm512_reduce_mul_pd(static_cast<__m512d>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmin(
+    simd<double, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_reduce_min_pd(static_cast<__m512d>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmax(
+    simd<double, simd_abi::avx512_fixed_size<8>> const& v) {
+  return _mm512_reduce_max_pd(static_cast<__m512d>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_xor<>) {
+  return Impl::avx512_hreduce_xor_epi32(static_cast<__m256i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint32_t reduce(
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_xor<>) {
+  return Impl::avx512_hreduce_xor_epi32(static_cast<__m256i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_xor<>) {
+  return Impl::avx512_hreduce_xor_epi64(static_cast<__m512i>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& v,
+    std::bit_xor<>) {
+  return Impl::avx512_hreduce_xor_epi64(static_cast<__m512i>(v));
+}
+
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+// masked reductions replace the inactive lanes with the identity element
+// using a single blend and then reuse the unmasked reductions above
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmin(const_where_expression<simd_mask<T, simd_abi::avx512_fixed_size<8>>,
+                            simd<T, simd_abi::avx512_fixed_size<8>>> const& x) {
+  return hmin(condition(
+      x.impl_get_mask(), x.impl_get_value(),
+      simd<T, simd_abi::avx512_fixed_size<8>>(
+          Kokkos::reduction_identity<T>::min())));
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmax(const_where_expression<simd_mask<T, simd_abi::avx512_fixed_size<8>>,
+                            simd<T, simd_abi::avx512_fixed_size<8>>> const& x) {
+  return hmax(condition(
+      x.impl_get_mask(), x.impl_get_value(),
+      simd<T, simd_abi::avx512_fixed_size<8>>(
+          Kokkos::reduction_identity<T>::max())));
+}
+
+template <class T, class BinaryOperation>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+reduce(const_where_expression<simd_mask<T, simd_abi::avx512_fixed_size<8>>,
+                              simd<T, simd_abi::avx512_fixed_size<8>>> const& x,
+       T identity_element, BinaryOperation op) {
+  return reduce(
+      condition(x.impl_get_mask(), x.impl_get_value(),
+                simd<T, simd_abi::avx512_fixed_size<8>>(identity_element)),
+      op);
+}
+
+// permute, compress and expand map directly onto vpermd/vpermq and the
+// AVX-512 vpcompress/vpexpand instructions
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>>
+    permute(simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& a,
+            simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_permutevar8x32_epi32(static_cast<__m256i>(a),
+                                  static_cast<__m256i>(index)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>>
+    compress(
+        simd_mask<std::int32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+        simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_maskz_compress_epi32(static_cast<__mmask8>(mask),
+                                  static_cast<__m256i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>>
+    expand(simd_mask<std::int32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+           simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_maskz_expand_epi32(static_cast<__mmask8>(mask),
+                                static_cast<__m256i>(a)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::int32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& a,
+    std::int32_t* mem) {
+  _mm256_mask_compressstoreu_epi32(mem, static_cast<__mmask8>(mask),
+                                   static_cast<__m256i>(a));
+  return _mm_popcnt_u32(static_cast<__mmask8>(mask));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>>
+    permute(simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& a,
+            simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+  return simd<std::uint32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_permutevar8x32_epi32(static_cast<__m256i>(a),
+                                  static_cast<__m256i>(index)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>>
+    compress(
+        simd_mask<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+        simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::uint32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_maskz_compress_epi32(static_cast<__mmask8>(mask),
+                                  static_cast<__m256i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>>
+    expand(simd_mask<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+           simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::uint32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_maskz_expand_epi32(static_cast<__mmask8>(mask),
+                                static_cast<__m256i>(a)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+    simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> const& a,
+    std::uint32_t* mem) {
+  _mm256_mask_compressstoreu_epi32(mem, static_cast<__mmask8>(mask),
+                                   static_cast<__m256i>(a));
+  return _mm_popcnt_u32(static_cast<__mmask8>(mask));
+}
+
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>>
+    permute(simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& a,
+            simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+  return simd<std::int64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_permutexvar_epi64(
+          Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(index)),
+          static_cast<__m512i>(a)));
+}
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>>
+    compress(
+        simd_mask<std::int64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+        simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::int64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask),
+                                  static_cast<__m512i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>>
+    expand(simd_mask<std::int64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+           simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::int64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_maskz_expand_epi64(static_cast<__mmask8>(mask),
+                                static_cast<__m512i>(a)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::int64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& a,
+    std::int64_t* mem) {
+  _mm512_mask_compressstoreu_epi64(mem, static_cast<__mmask8>(mask),
+                                   static_cast<__m512i>(a));
+  return _mm_popcnt_u32(static_cast<__mmask8>(mask));
+}
+
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>>
+    permute(simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& a,
+            simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+  return simd<std::uint64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_permutexvar_epi64(
+          Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(index)),
+          static_cast<__m512i>(a)));
+}
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>>
+    compress(
+        simd_mask<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+        simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::uint64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask),
+                                  static_cast<__m512i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>>
+    expand(simd_mask<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+           simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<std::uint64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_maskz_expand_epi64(static_cast<__mmask8>(mask),
+                                static_cast<__m512i>(a)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+    simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> const& a,
+    std::uint64_t* mem) {
+  _mm512_mask_compressstoreu_epi64(mem, static_cast<__mmask8>(mask),
+                                   static_cast<__m512i>(a));
+  return _mm_popcnt_u32(static_cast<__mmask8>(mask));
+}
+
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    permute(simd<double, simd_abi::avx512_fixed_size<8>> const& a,
+            simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& index) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_permutexvar_pd(
+          Impl::avx512_cvtepi32_epi64(static_cast<__m256i>(index)),
+          static_cast<__m512d>(a)));
+}
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    compress(simd_mask<double, simd_abi::avx512_fixed_size<8>> const& mask,
+             simd<double, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_maskz_compress_pd(static_cast<__mmask8>(mask),
+                               static_cast<__m512d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    expand(simd_mask<double, simd_abi::avx512_fixed_size<8>> const& mask,
+           simd<double, simd_abi::avx512_fixed_size<8>> const& a) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_maskz_expand_pd(static_cast<__mmask8>(mask),
+                             static_cast<__m512d>(a)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<double, simd_abi::avx512_fixed_size<8>> const& mask,
+    simd<double, simd_abi::avx512_fixed_size<8>> const& a, double* mem) {
+  _mm512_mask_compressstoreu_pd(mem, static_cast<__mmask8>(mask),
+                                static_cast<__m512d>(a));
+  return _mm_popcnt_u32(static_cast<__mmask8>(mask));
+}
+
+// simd<Kokkos::complex<double>> keeps the lanes in the interleaved
+// (real, imag) layout of Kokkos::complex so that loads and stores from
+// complex arrays are plain vector moves: lanes 0 to 3 live in m_low and
+// lanes 4 to 7 in m_high
+
+namespace Impl {
+
+// (a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re) for each complex
+// pair of the registers, using fmaddsub to subtract in the even and add in
+// the odd elements
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d
+avx512_complex_mul(__m512d const& a, __m512d const& b) {
+  __m512d const a_real    = _mm512_movedup_pd(a);
+  __m512d const a_imag    = _mm512_permute_pd(a, 0xFF);
+  __m512d const b_swapped = _mm512_permute_pd(b, 0x55);
+  return _mm512_fmaddsub_pd(a_real, b, _mm512_mul_pd(a_imag, b_swapped));
+}
+
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d
+avx512_complex_conj(__m512d const& a) {
+  return _mm512_castsi512_pd(_mm512_xor_epi64(
+      _mm512_castpd_si512(a),
+      _mm512_castpd_si512(
+          _mm512_setr_pd(0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0))));
+}
+
+// re * re + im * im broadcast to both elements of each complex pair
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d
+avx512_complex_norm(__m512d const& a) {
+  __m512d const squares = _mm512_mul_pd(a, a);
+  return _mm512_add_pd(squares, _mm512_permute_pd(squares, 0x55));
+}
+
+// a / b like Kokkos::complex: both are scaled by |b.re| + |b.im| so that the
+// norm of b neither overflows nor underflows, and a zero b gives a / 0
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d
+avx512_complex_div(__m512d const& a, __m512d const& b) {
+  __m512d const abs_b    = _mm512_abs_pd(b);
+  __m512d const scale    = _mm512_add_pd(abs_b, _mm512_permute_pd(abs_b, 0x55));
+  __m512d const a_scaled = _mm512_div_pd(a, scale);
+  __m512d const b_scaled = _mm512_div_pd(b, scale);
+  __m512d const quotient =
+      _mm512_div_pd(avx512_complex_mul(a_scaled, avx512_complex_conj(b_scaled)),
+                    avx512_complex_norm(b_scaled));
+  return _mm512_mask_blend_pd(
+      _mm512_cmp_pd_mask(scale, _mm512_setzero_pd(), _CMP_EQ_OQ), quotient,
+      a_scaled);
+}
+KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
+// gathers the even (real) or odd (imaginary) elements of low and high
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d
+avx512_complex_real(__m512d const& low, __m512d const& high) {
+  return _mm512_permutex2var_pd(
+      low, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), high);
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d
+avx512_complex_imag(__m512d const& low, __m512d const& high) {
+  return _mm512_permutex2var_pd(
+      low, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), high);
+}
+
+// the masks of the doubles of the complex lanes 0 to 3 (low) or 4 to 7
+// (high), each lane bit repeated for its real and imaginary parts
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __mmask8
+avx512_complex_half_mask(unsigned lanes) {
+  lanes &= 0xF;
+  lanes = (lanes | (lanes << 2)) & 0x33;
+  lanes = (lanes | (lanes << 1)) & 0x55;
+  return static_cast<__mmask8>(lanes | (lanes << 1));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __mmask8
+avx512_complex_low_mask(__mmask8 mask) {
+  return avx512_complex_half_mask(mask);
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __mmask8
+avx512_complex_high_mask(__mmask8 mask) {
+  return avx512_complex_half_mask(unsigned(mask) >> 4);
+}
+
+}  // namespace Impl
+
+template <>
+class simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>> {
+  __m512d m_low;
+  __m512d m_high;
+
+ public:
+  using value_type = Kokkos::complex<double>;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd&&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value) {
+    value_type const v(value);
+    m_low  = _mm512_setr_pd(v.real(), v.imag(), v.real(), v.imag(), v.real(),
+                           v.imag(), v.real(), v.imag());
+    m_high = m_low;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(
+      simd<double, abi_type> const& real_part,
+      simd<double, abi_type> const& imag_part)
+      : m_low(_mm512_permutex2var_pd(
+            static_cast<__m512d>(real_part),
+            _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11),
+            static_cast<__m512d>(imag_part))),
+        m_high(_mm512_permutex2var_pd(
+            static_cast<__m512d>(real_part),
+            _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15),
+            static_cast<__m512d>(imag_part))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr simd(__m512d const& low,
+                                                       __m512d const& high)
+      : m_low(low), m_high(high) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    double values[16];
+    _mm512_storeu_pd(values, m_low);
+    _mm512_storeu_pd(values + 8, m_high);
+    return value_type(values[2 * i], values[2 * i + 1]);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_low  = _mm512_loadu_pd(reinterpret_cast<double const*>(ptr));
+    m_high = _mm512_loadu_pd(reinterpret_cast<double const*>(ptr + 4));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm512_storeu_pd(reinterpret_cast<double*>(ptr), m_low);
+    _mm512_storeu_pd(reinterpret_cast<double*>(ptr + 4), m_high);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_low  = _mm512_load_pd(reinterpret_cast<double const*>(ptr));
+    m_high = _mm512_load_pd(reinterpret_cast<double const*>(ptr + 4));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, vector_aligned_tag) const {
+    _mm512_store_pd(reinterpret_cast<double*>(ptr), m_low);
+    _mm512_store_pd(reinterpret_cast<double*>(ptr + 4), m_high);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d impl_get_low() const {
+    return m_low;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m512d impl_get_high() const {
+    return m_high;
+  }
+};
+
+template <>
+class const_where_expression<
+    simd_mask<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>,
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>> {
+ public:
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using value_type = simd<Kokkos::complex<double>, abi_type>;
+  using mask_type  = simd_mask<Kokkos::complex<double>, abi_type>;
+
+ protected:
+  value_type& m_value;
+  mask_type const& m_mask;
+
+ public:
+  const_where_expression(mask_type const& mask_arg, value_type const& value_arg)
+      : m_value(const_cast<value_type&>(value_arg)), m_mask(mask_arg) {}
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(Kokkos::complex<double>* mem, element_aligned_tag) const {
+    __mmask8 const mask = static_cast<__mmask8>(m_mask);
+    _mm512_mask_storeu_pd(reinterpret_cast<double*>(mem),
+                          Impl::avx512_complex_low_mask(mask),
+                          m_value.impl_get_low());
+    _mm512_mask_storeu_pd(reinterpret_cast<double*>(mem + 4),
+                          Impl::avx512_complex_high_mask(mask),
+                          m_value.impl_get_high());
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
+  impl_get_value() const {
+    return m_value;
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type const&
+  impl_get_mask() const {
+    return m_mask;
+  }
+};
+
+template <>
+class where_expression<
+    simd_mask<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>,
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>>
+    : public const_where_expression<
+          simd_mask<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>,
+          simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>> {
+ public:
+  where_expression(mask_type const& mask_arg, value_type& value_arg)
+      : const_where_expression(mask_arg, value_arg) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(Kokkos::complex<double> const* mem, element_aligned_tag) {
+    __mmask8 const mask = static_cast<__mmask8>(m_mask);
+    __m512d const low   = _mm512_maskz_loadu_pd(
+        Impl::avx512_complex_low_mask(mask),
+        reinterpret_cast<double const*>(mem));
+    __m512d const high  = _mm512_maskz_loadu_pd(
+        Impl::avx512_complex_high_mask(mask),
+        reinterpret_cast<double const*>(mem + 4));
+    m_value = value_type(low, high);
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void operator=(U&& x) {
+    auto const x_as_value_type = static_cast<value_type>(std::forward<U>(x));
+    __mmask8 const mask        = static_cast<__mmask8>(m_mask);
+    __m512d const low          = _mm512_mask_blend_pd(
+        Impl::avx512_complex_low_mask(mask), m_value.impl_get_low(),
+        x_as_value_type.impl_get_low());
+    __m512d const high         = _mm512_mask_blend_pd(
+        Impl::avx512_complex_high_mask(mask), m_value.impl_get_high(),
+        x_as_value_type.impl_get_high());
+    m_value = value_type(low, high);
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>
+    operator+(simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& lhs,
+              simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>(
+      _mm512_add_pd(lhs.impl_get_low(), rhs.impl_get_low()),
+      _mm512_add_pd(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>
+    operator-(simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& lhs,
+              simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>(
+      _mm512_sub_pd(lhs.impl_get_low(), rhs.impl_get_low()),
+      _mm512_sub_pd(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>
+    operator-(simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& a) {
+  __m512d const zero = _mm512_setzero_pd();
+  return simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>(
+      _mm512_sub_pd(zero, a.impl_get_low()),
+      _mm512_sub_pd(zero, a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>
+    operator*(simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& lhs,
+              simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>(
+      Impl::avx512_complex_mul(lhs.impl_get_low(), rhs.impl_get_low()),
+      Impl::avx512_complex_mul(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>
+    operator/(simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& lhs,
+              simd<Kokkos::complex<double>,
+                   simd_abi::avx512_fixed_size<8>> const& rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>(
+      Impl::avx512_complex_div(lhs.impl_get_low(), rhs.impl_get_low()),
+      Impl::avx512_complex_div(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>
+    conj(simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>>(
+      Impl::avx512_complex_conj(a.impl_get_low()),
+      Impl::avx512_complex_conj(a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    real(simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      Impl::avx512_complex_real(a.impl_get_low(), a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    imag(simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      Impl::avx512_complex_imag(a.impl_get_low(), a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    norm(simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  __m512d const low  = _mm512_mul_pd(a.impl_get_low(), a.impl_get_low());
+  __m512d const high = _mm512_mul_pd(a.impl_get_high(), a.impl_get_high());
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_add_pd(Impl::avx512_complex_real(low, high),
+                    Impl::avx512_complex_imag(low, high)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    abs(simd<Kokkos::complex<double>, simd_abi::avx512_fixed_size<8>> const&
+            a) {
+  return Impl::complex_abs(real(a), imag(a));
 }
 
 }  // namespace Experimental
 }  // namespace Kokkos
 
+#undef KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_PUSH
+#undef KOKKOS_IMPL_AVX512_IGNORE_UNINITIALIZED_POP
+
 #endif
@@ -19,13 +19,35 @@
 
 #include <cmath>
 #include <cstring>
+#include <functional>
 
 #include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Half_BulkConversion.hpp>
 
 namespace Kokkos {
 
 namespace Experimental {
 
+namespace Impl {
+
+// The x86 integer vector types are vectors of long long, and GCC assumes
+// that their storage is only accessed as long long or as whole vectors. The
+// lanes of the other integer types are accessed through these types instead,
+// which may alias any object.
+#if defined(__GNUC__)
+typedef std::int32_t __attribute__((__may_alias__)) may_alias_int32_t;
+typedef std::uint32_t __attribute__((__may_alias__)) may_alias_uint32_t;
+typedef std::int64_t __attribute__((__may_alias__)) may_alias_int64_t;
+typedef std::uint64_t __attribute__((__may_alias__)) may_alias_uint64_t;
+#else
+using may_alias_int32_t  = std::int32_t;
+using may_alias_uint32_t = std::uint32_t;
+using may_alias_int64_t  = std::int64_t;
+using may_alias_uint64_t = std::uint64_t;
+#endif
+
+}  // namespace Impl
+
 template <class T, class Abi>
 class simd;
 
@@ -34,6 +56,11 @@ class simd_mask;
 
 struct element_aligned_tag {};
 
+// memory aligned to the full width of the vector is also element aligned,
+// so overloads taking element_aligned_tag accept vector_aligned_tag as well
+// and only the Abi types with faster aligned instructions need overloads
+struct vector_aligned_tag : element_aligned_tag {};
+
 // class template declarations for const_where_expression and where_expression
 
 template <class M, class T>
@@ -325,6 +352,40 @@ template <class T, class Abi>
   return a == simd_mask<T, Abi>(false);
 }
 
+// fallback implementations of horizontal reductions.
+// individual Abi types provide overloads built on shuffle trees or
+// native masked reductions for the common operations
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmin(simd<T, Abi> const& v) {
+  auto result = v[0];
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    result = Kokkos::min(result, v[i]);
+  }
+  return result;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmax(simd<T, Abi> const& v) {
+  auto result = v[0];
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    result = Kokkos::max(result, v[i]);
+  }
+  return result;
+}
+
+template <class T, class Abi, class BinaryOperation = std::plus<>>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+reduce(simd<T, Abi> const& v, BinaryOperation op = {}) {
+  T result = v[0];
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    result = op(result, v[i]);
+  }
+  return result;
+}
+
 template <typename T, typename Abi>
 [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
 hmin(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x) {
@@ -349,19 +410,147 @@ hmax(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x) {
   return result;
 }
 
-template <class T, class Abi>
+template <class T, class Abi, class BinaryOperation>
 [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
-reduce(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x, T,
-       std::plus<>) {
+reduce(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x,
+       T identity_element, BinaryOperation op) {
   auto const& v = x.impl_get_value();
   auto const& m = x.impl_get_mask();
-  auto result   = Kokkos::reduction_identity<T>::sum();
+  auto result   = identity_element;
   for (std::size_t i = 0; i < v.size(); ++i) {
-    if (m[i]) result += v[i];
+    if (m[i]) result = op(result, v[i]);
+  }
+  return result;
+}
+
+// fallback implementations of lane permutations.
+// permute(a, index) returns the simd whose lane i is a[index[i]].
+// compress(mask, a) packs the lanes of a selected by mask into the lowest
+// lanes and expand(mask, a) is its inverse, distributing the lowest lanes of
+// a to the lanes selected by mask. unselected result lanes are zero.
+// compress_store(mask, a, mem) writes the selected lanes contiguously to mem
+// and returns how many were written.
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> permute(
+    simd<T, Abi> const& a, simd<std::int32_t, Abi> const& index) {
+  T values[simd<T, Abi>::size()];
+  for (std::size_t i = 0; i < a.size(); ++i) values[i] = a[index[i]];
+  simd<T, Abi> result;
+  result.copy_from(values, element_aligned_tag());
+  return result;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> compress(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a) {
+  T values[simd<T, Abi>::size()] = {};
+  std::size_t count              = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (mask[i]) values[count++] = a[i];
+  }
+  simd<T, Abi> result;
+  result.copy_from(values, element_aligned_tag());
+  return result;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> expand(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a) {
+  T values[simd<T, Abi>::size()] = {};
+  std::size_t count              = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (mask[i]) values[i] = a[count++];
   }
+  simd<T, Abi> result;
+  result.copy_from(values, element_aligned_tag());
   return result;
 }
 
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a, T* mem) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (mask[i]) mem[count++] = a[i];
+  }
+  return count;
+}
+
+// half precision storage. there is no simd<half_t>, these load half_t or
+// bhalf_t values into a simd<double> and store them back through the bulk
+// conversion kernels, which convert the lanes with vector instructions where
+// the architecture has them. narrowing rounds the double to nearest even
+// directly.
+
+namespace Impl {
+
+template <class T>
+inline constexpr bool is_half_precision_v =
+    std::is_same_v<T, Kokkos::Experimental::half_t> ||
+    std::is_same_v<T, Kokkos::Experimental::bhalf_t>;
+
+}  // namespace Impl
+
+template <class T, class Abi>
+inline std::enable_if_t<Impl::is_half_precision_v<T>> copy_from_half(
+    simd<double, Abi>& value, T const* ptr, element_aligned_tag) {
+  double values[simd<double, Abi>::size()];
+  if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+    auto const* bits = reinterpret_cast<std::uint16_t const*>(ptr);
+    if constexpr (std::is_same_v<T, Kokkos::Experimental::half_t>) {
+      Kokkos::Impl::convert_half_to_double(bits, values, value.size());
+    } else {
+      Kokkos::Impl::convert_bhalf_to_double(bits, values, value.size());
+    }
+  } else {
+    for (std::size_t i = 0; i < value.size(); ++i) values[i] = double(ptr[i]);
+  }
+  value.copy_from(values, element_aligned_tag());
+}
+
+template <class T, class Abi>
+inline std::enable_if_t<Impl::is_half_precision_v<T>> copy_to_half(
+    simd<double, Abi> const& value, T* ptr, element_aligned_tag) {
+  if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+    double values[simd<double, Abi>::size()];
+    value.copy_to(values, element_aligned_tag());
+    auto* bits = reinterpret_cast<std::uint16_t*>(ptr);
+    if constexpr (std::is_same_v<T, Kokkos::Experimental::half_t>) {
+      Kokkos::Impl::convert_double_to_half(values, bits, value.size());
+    } else {
+      Kokkos::Impl::convert_double_to_bhalf(values, bits, value.size());
+    }
+  } else {
+    for (std::size_t i = 0; i < value.size(); ++i) ptr[i] = T(value[i]);
+  }
+}
+
+namespace Impl {
+
+// magnitude of the complex lanes (real_part, imag_part) of the Abi types
+// with a simd<Kokkos::complex<double>>. it is computed as
+// big * sqrt(1 + (small / big)^2), big and small being the larger and the
+// smaller of the absolute values of the parts, which overflows or underflows
+// only when the magnitude does. equal parts, including two zeros or two
+// infinities, take a ratio of one, and a NaN part gives NaN, which the x86
+// max and min do not propagate.
+template <class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi>
+complex_abs(simd<double, Abi> const& real_part,
+            simd<double, Abi> const& imag_part) {
+  simd<double, Abi> const one(1.0);
+  simd<double, Abi> const abs_real = abs(real_part);
+  simd<double, Abi> const abs_imag = abs(imag_part);
+  simd<double, Abi> const big      = max(abs_real, abs_imag);
+  simd<double, Abi> const small    = min(abs_real, abs_imag);
+  simd<double, Abi> const ratio    = condition(big == small, one, small / big);
+  simd<double, Abi> const sum      = abs_real + abs_imag;
+  return condition(sum == sum, big * sqrt(one + ratio * ratio), sum);
+}
+
+}  // namespace Impl
+
 }  // namespace Experimental
 
 template <class T, class Abi>
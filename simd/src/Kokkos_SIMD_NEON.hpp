@@ -225,14 +225,22 @@ class neon_mask<Derived, 32> {
   }
 };
 
+// the lanes of a simd<Kokkos::complex<double>> are selected by the 64-bit
+// masks of simd<double>
+template <class T>
+inline constexpr int neon_mask_bits = sizeof(T) * 8;
+
+template <>
+inline constexpr int neon_mask_bits<Kokkos::complex<double>> = 64;
+
 }  // namespace Impl
 
 template <class T>
 class simd_mask<T, simd_abi::neon_fixed_size<2>>
     : public Impl::neon_mask<simd_mask<T, simd_abi::neon_fixed_size<2>>,
-                             sizeof(T) * 8> {
+                             Impl::neon_mask_bits<T>> {
   using base_type = Impl::neon_mask<simd_mask<T, simd_abi::neon_fixed_size<2>>,
-                                    sizeof(T) * 8>;
+                                    Impl::neon_mask_bits<T>>;
 
  public:
   using implementation_type = typename base_type::implementation_type;
@@ -969,6 +977,13 @@ class const_where_expression<
     if (m_mask[0]) mem[0] = m_value[0];
     if (m_mask[1]) mem[1] = m_value[1];
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::int32_t* mem,
+      simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& index) const {
+    if (m_mask[0]) mem[index[0]] = m_value[0];
+    if (m_mask[1]) mem[index[1]] = m_value[1];
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -997,6 +1012,13 @@ class where_expression<simd_mask<std::int32_t, simd_abi::neon_fixed_size<2>>,
     if (m_mask[0]) m_value[0] = mem[0];
     if (m_mask[1]) m_value[1] = mem[1];
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::int32_t const* mem,
+      simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& index) {
+    if (m_mask[0]) m_value[0] = mem[index[0]];
+    if (m_mask[1]) m_value[1] = mem[index[1]];
+  }
   template <
       class U,
       std::enable_if_t<
@@ -1035,6 +1057,13 @@ class const_where_expression<
     if (m_mask[0]) mem[0] = m_value[0];
     if (m_mask[1]) mem[1] = m_value[1];
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::int64_t* mem,
+      simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& index) const {
+    if (m_mask[0]) mem[index[0]] = m_value[0];
+    if (m_mask[1]) mem[index[1]] = m_value[1];
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1063,6 +1092,13 @@ class where_expression<simd_mask<std::int64_t, simd_abi::neon_fixed_size<2>>,
     if (m_mask[0]) m_value[0] = mem[0];
     if (m_mask[1]) m_value[1] = mem[1];
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::int64_t const* mem,
+      simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& index) {
+    if (m_mask[0]) m_value[0] = mem[index[0]];
+    if (m_mask[1]) m_value[1] = mem[index[1]];
+  }
   template <
       class U,
       std::enable_if_t<std::is_convertible_v<
@@ -1101,6 +1137,13 @@ class const_where_expression<
     if (m_mask[0]) mem[0] = m_value[0];
     if (m_mask[1]) mem[1] = m_value[1];
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void scatter_to(
+      std::uint64_t* mem,
+      simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& index) const {
+    if (m_mask[0]) mem[index[0]] = m_value[0];
+    if (m_mask[1]) mem[index[1]] = m_value[1];
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
   impl_get_value() const {
@@ -1129,6 +1172,13 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::neon_fixed_size<2>>,
     if (m_mask[0]) m_value[0] = mem[0];
     if (m_mask[1]) m_value[1] = mem[1];
   }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void gather_from(
+      std::uint64_t const* mem,
+      simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& index) {
+    if (m_mask[0]) m_value[0] = mem[index[0]];
+    if (m_mask[1]) m_value[1] = mem[index[1]];
+  }
   template <class U,
             std::enable_if_t<
                 std::is_convertible_v<
@@ -1145,6 +1195,344 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::neon_fixed_size<2>>,
   }
 };
 
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::neon_fixed_size<2>> const& v, std::plus<> = {}) {
+  return vaddvq_f64(static_cast<float64x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::neon_fixed_size<2>> const& v, std::multiplies<>) {
+  float64x2_t const a = static_cast<float64x2_t>(v);
+  return vgetq_lane_f64(a, 0) * vgetq_lane_f64(a, 1);
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmin(
+    simd<double, simd_abi::neon_fixed_size<2>> const& v) {
+  return vminvq_f64(static_cast<float64x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION double hmax(
+    simd<double, simd_abi::neon_fixed_size<2>> const& v) {
+  return vmaxvq_f64(static_cast<float64x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t reduce(
+    simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& v,
+    std::plus<> = {}) {
+  return vaddv_s32(static_cast<int32x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t hmin(
+    simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& v) {
+  return vminv_s32(static_cast<int32x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t hmax(
+    simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& v) {
+  return vmaxv_s32(static_cast<int32x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int64_t reduce(
+    simd<std::int64_t, simd_abi::neon_fixed_size<2>> const& v,
+    std::plus<> = {}) {
+  return vaddvq_s64(static_cast<int64x2_t>(v));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::uint64_t reduce(
+    simd<std::uint64_t, simd_abi::neon_fixed_size<2>> const& v,
+    std::plus<> = {}) {
+  return vaddvq_u64(static_cast<uint64x2_t>(v));
+}
+
+// masked reductions replace the inactive lanes with the identity element
+// using a bitwise select and then reuse the across-vector reductions above
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmin(const_where_expression<simd_mask<T, simd_abi::neon_fixed_size<2>>,
+                            simd<T, simd_abi::neon_fixed_size<2>>> const& x) {
+  return hmin(condition(x.impl_get_mask(), x.impl_get_value(),
+                        simd<T, simd_abi::neon_fixed_size<2>>(
+                            Kokkos::reduction_identity<T>::min())));
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmax(const_where_expression<simd_mask<T, simd_abi::neon_fixed_size<2>>,
+                            simd<T, simd_abi::neon_fixed_size<2>>> const& x) {
+  return hmax(condition(x.impl_get_mask(), x.impl_get_value(),
+                        simd<T, simd_abi::neon_fixed_size<2>>(
+                            Kokkos::reduction_identity<T>::max())));
+}
+
+template <class T, class BinaryOperation>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+reduce(const_where_expression<simd_mask<T, simd_abi::neon_fixed_size<2>>,
+                              simd<T, simd_abi::neon_fixed_size<2>>> const& x,
+       T identity_element, BinaryOperation op) {
+  return reduce(
+      condition(x.impl_get_mask(), x.impl_get_value(),
+                simd<T, simd_abi::neon_fixed_size<2>>(identity_element)),
+      op);
+}
+
+// simd<Kokkos::complex<double>> keeps each lane in the interleaved
+// (real, imag) layout of Kokkos::complex, one lane per register
+
+namespace Impl {
+
+// (a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re)
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float64x2_t
+neon_complex_mul(float64x2_t const& a, float64x2_t const& b) {
+  float64x2_t const real_products = vmulq_laneq_f64(b, a, 0);
+  float64x2_t const imag_products = vmulq_laneq_f64(vextq_f64(b, b, 1), a, 1);
+  return vfmaq_f64(real_products, imag_products,
+                   vcombine_f64(vdup_n_f64(-1.0), vdup_n_f64(1.0)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float64x2_t
+neon_complex_conj(float64x2_t const& a) {
+  return vmulq_f64(a, vcombine_f64(vdup_n_f64(1.0), vdup_n_f64(-1.0)));
+}
+
+// a / b like Kokkos::complex: both are scaled by |b.re| + |b.im| so that the
+// norm of b neither overflows nor underflows, and a zero b gives a / 0
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float64x2_t
+neon_complex_div(float64x2_t const& a, float64x2_t const& b) {
+  float64x2_t const abs_b    = vabsq_f64(b);
+  float64x2_t const scale    = vpaddq_f64(abs_b, abs_b);
+  float64x2_t const a_scaled = vdivq_f64(a, scale);
+  float64x2_t const b_scaled = vdivq_f64(b, scale);
+  float64x2_t const squares  = vmulq_f64(b_scaled, b_scaled);
+  float64x2_t const quotient =
+      vdivq_f64(neon_complex_mul(a_scaled, neon_complex_conj(b_scaled)),
+                vpaddq_f64(squares, squares));
+  return vbslq_f64(vceqzq_f64(scale), a_scaled, quotient);
+}
+
+}  // namespace Impl
+
+template <>
+class simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> {
+  float64x2_t m_low;
+  float64x2_t m_high;
+
+ public:
+  using value_type = Kokkos::complex<double>;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()            = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)      = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd&&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value) {
+    value_type const v(value);
+    m_low  = vcombine_f64(vdup_n_f64(v.real()), vdup_n_f64(v.imag()));
+    m_high = m_low;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(
+      simd<double, abi_type> const& real_part,
+      simd<double, abi_type> const& imag_part)
+      : m_low(vzip1q_f64(static_cast<float64x2_t>(real_part),
+                         static_cast<float64x2_t>(imag_part))),
+        m_high(vzip2q_f64(static_cast<float64x2_t>(real_part),
+                          static_cast<float64x2_t>(imag_part))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(float64x2_t const& low,
+                                             float64x2_t const& high)
+      : m_low(low), m_high(high) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    float64x2_t const lane = i == 0 ? m_low : m_high;
+    return value_type(vgetq_lane_f64(lane, 0), vgetq_lane_f64(lane, 1));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_low  = vld1q_f64(reinterpret_cast<double const*>(ptr));
+    m_high = vld1q_f64(reinterpret_cast<double const*>(ptr + 1));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    vst1q_f64(reinterpret_cast<double*>(ptr), m_low);
+    vst1q_f64(reinterpret_cast<double*>(ptr + 1), m_high);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float64x2_t impl_get_low() const {
+    return m_low;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float64x2_t impl_get_high() const {
+    return m_high;
+  }
+};
+
+template <>
+class const_where_expression<
+    simd_mask<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>,
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>> {
+ public:
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using value_type = simd<Kokkos::complex<double>, abi_type>;
+  using mask_type  = simd_mask<Kokkos::complex<double>, abi_type>;
+
+ protected:
+  value_type& m_value;
+  mask_type const& m_mask;
+
+ public:
+  const_where_expression(mask_type const& mask_arg, value_type const& value_arg)
+      : m_value(const_cast<value_type&>(value_arg)), m_mask(mask_arg) {}
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(Kokkos::complex<double>* mem, element_aligned_tag) const {
+    if (m_mask[0]) {
+      vst1q_f64(reinterpret_cast<double*>(mem), m_value.impl_get_low());
+    }
+    if (m_mask[1]) {
+      vst1q_f64(reinterpret_cast<double*>(mem + 1), m_value.impl_get_high());
+    }
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
+  impl_get_value() const {
+    return m_value;
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type const&
+  impl_get_mask() const {
+    return m_mask;
+  }
+};
+
+template <>
+class where_expression<
+    simd_mask<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>,
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>>
+    : public const_where_expression<
+          simd_mask<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>,
+          simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>> {
+ public:
+  where_expression(mask_type const& mask_arg, value_type& value_arg)
+      : const_where_expression(mask_arg, value_arg) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(Kokkos::complex<double> const* mem, element_aligned_tag) {
+    float64x2_t low  = m_value.impl_get_low();
+    float64x2_t high = m_value.impl_get_high();
+    if (m_mask[0]) low = vld1q_f64(reinterpret_cast<double const*>(mem));
+    if (m_mask[1]) high = vld1q_f64(reinterpret_cast<double const*>(mem + 1));
+    m_value = value_type(low, high);
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void operator=(U&& x) {
+    auto const x_as_value_type = static_cast<value_type>(std::forward<U>(x));
+    uint64x2_t const mask      = static_cast<uint64x2_t>(m_mask);
+    float64x2_t const low      = vbslq_f64(vdupq_laneq_u64(mask, 0),
+                                      x_as_value_type.impl_get_low(),
+                                      m_value.impl_get_low());
+    float64x2_t const high     = vbslq_f64(vdupq_laneq_u64(mask, 1),
+                                       x_as_value_type.impl_get_high(),
+                                       m_value.impl_get_high());
+    m_value = value_type(low, high);
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>
+    operator+(
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>(
+      vaddq_f64(lhs.impl_get_low(), rhs.impl_get_low()),
+      vaddq_f64(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>
+    operator-(
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>(
+      vsubq_f64(lhs.impl_get_low(), rhs.impl_get_low()),
+      vsubq_f64(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>
+    operator-(
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const& a) {
+  return simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>(
+      vnegq_f64(a.impl_get_low()), vnegq_f64(a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>
+    operator*(
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>(
+      Impl::neon_complex_mul(lhs.impl_get_low(), rhs.impl_get_low()),
+      Impl::neon_complex_mul(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>
+    operator/(
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const& lhs,
+        simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+            rhs) {
+  return simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>(
+      Impl::neon_complex_div(lhs.impl_get_low(), rhs.impl_get_low()),
+      Impl::neon_complex_div(lhs.impl_get_high(), rhs.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>
+    conj(simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+             a) {
+  return simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>>(
+      Impl::neon_complex_conj(a.impl_get_low()),
+      Impl::neon_complex_conj(a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    real(simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+             a) {
+  return simd<double, simd_abi::neon_fixed_size<2>>(
+      vzip1q_f64(a.impl_get_low(), a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    imag(simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+             a) {
+  return simd<double, simd_abi::neon_fixed_size<2>>(
+      vzip2q_f64(a.impl_get_low(), a.impl_get_high()));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    norm(simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+             a) {
+  return simd<double, simd_abi::neon_fixed_size<2>>(
+      vpaddq_f64(vmulq_f64(a.impl_get_low(), a.impl_get_low()),
+                 vmulq_f64(a.impl_get_high(), a.impl_get_high())));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    abs(simd<Kokkos::complex<double>, simd_abi::neon_fixed_size<2>> const&
+            a) {
+  return Impl::complex_abs(real(a), imag(a));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -0,0 +1,333 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_RANGE_HPP
+#define KOKKOS_SIMD_RANGE_HPP
+
+#include <Kokkos_SIMD_Common.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class SimdChunk
+/// \brief One SIMD-width piece of the iteration range of a SimdRangePolicy.
+///
+/// The functor of a SimdRangePolicy is called with one SimdChunk per piece.
+/// All chunks are full except possibly the last one, for which mask()
+/// selects the lanes that are still inside the range.
+template <class Abi>
+class SimdChunk {
+ public:
+  using abi_type   = Abi;
+  using index_type = std::int64_t;
+
+  // fixed size Abi types have the same number of lanes for every element
+  // type, so the width of the double specialization is used
+  static constexpr std::size_t width = simd<double, abi_type>::size();
+
+ private:
+  index_type m_begin;
+  std::size_t m_size;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION SimdChunk(index_type begin_arg,
+                                        std::size_t size_arg)
+      : m_begin(begin_arg), m_size(size_arg) {}
+
+  /// Index of the element loaded into lane 0
+  KOKKOS_FORCEINLINE_FUNCTION index_type begin() const { return m_begin; }
+  /// Number of lanes that are inside the iteration range
+  KOKKOS_FORCEINLINE_FUNCTION std::size_t size() const { return m_size; }
+  KOKKOS_FORCEINLINE_FUNCTION bool is_full() const { return m_size == width; }
+
+  template <class T>
+  KOKKOS_FORCEINLINE_FUNCTION simd_mask<T, abi_type> mask() const {
+    simd_mask<T, abi_type> result(false);
+    for (std::size_t lane = 0; lane < m_size; ++lane) result[lane] = true;
+    return result;
+  }
+};
+
+/// \class SimdRangePolicy
+/// \brief Execution policy over [begin, end) that hands the functor
+/// SimdChunk objects instead of individual indices.
+///
+/// Functors are called as functor(chunk) for parallel_for and as
+/// functor(chunk, update) for parallel_reduce. simd_load and simd_store
+/// take care of the masked remainder when accessing rank-1 Views.
+template <class ExecutionSpace = Kokkos::DefaultExecutionSpace,
+          class Abi            = simd_abi::ForSpace<ExecutionSpace>>
+class SimdRangePolicy {
+ public:
+  using execution_space = ExecutionSpace;
+  using abi_type        = Abi;
+  using chunk_type      = SimdChunk<abi_type>;
+  using index_type      = typename chunk_type::index_type;
+  using chunk_policy_type =
+      Kokkos::RangePolicy<execution_space, Kokkos::IndexType<index_type>>;
+
+  static constexpr std::size_t width = chunk_type::width;
+
+ private:
+  execution_space m_space;
+  index_type m_begin;
+  index_type m_end;
+
+ public:
+  SimdRangePolicy(index_type begin_arg, index_type end_arg)
+      : SimdRangePolicy(execution_space(), begin_arg, end_arg) {}
+  SimdRangePolicy(execution_space const& space_arg, index_type begin_arg,
+                  index_type end_arg)
+      : m_space(space_arg), m_begin(begin_arg), m_end(end_arg) {
+    if (m_end < m_begin) {
+      std::string msg = "Kokkos::Experimental::SimdRangePolicy bounds error: ";
+      msg += "The lower bound (" + std::to_string(m_begin) + ") is greater ";
+      msg += "than the upper bound (" + std::to_string(m_end) + ").\n";
+      Kokkos::abort(msg.c_str());
+    }
+  }
+
+  execution_space const& space() const { return m_space; }
+  index_type begin() const { return m_begin; }
+  index_type end() const { return m_end; }
+  index_type chunk_count() const {
+    return (m_end - m_begin + index_type(width) - 1) / index_type(width);
+  }
+
+  chunk_policy_type impl_chunk_policy() const {
+    return chunk_policy_type(m_space, 0, chunk_count());
+  }
+};
+
+namespace Impl {
+
+template <class Abi>
+KOKKOS_FORCEINLINE_FUNCTION SimdChunk<Abi> make_simd_chunk(std::int64_t begin,
+                                                           std::int64_t end,
+                                                           std::int64_t chunk) {
+  auto const width = std::int64_t(SimdChunk<Abi>::width);
+  auto const first = begin + chunk * width;
+  return SimdChunk<Abi>(first, std::size_t(Kokkos::min(end - first, width)));
+}
+
+template <class Abi, class Functor>
+class SimdChunkForFunctor {
+  Functor m_functor;
+  std::int64_t m_begin;
+  std::int64_t m_end;
+
+ public:
+  SimdChunkForFunctor(Functor const& functor_arg, std::int64_t begin_arg,
+                      std::int64_t end_arg)
+      : m_functor(functor_arg), m_begin(begin_arg), m_end(end_arg) {}
+  KOKKOS_FUNCTION void operator()(std::int64_t chunk) const {
+    m_functor(make_simd_chunk<Abi>(m_begin, m_end, chunk));
+  }
+};
+
+// the reduction over the chunks only sees SimdChunkReduceFunctor, which has
+// the join, init and final member functions of the functor if it has them.
+// each base adds one of them on top of the previous ones.
+template <class Functor, class ValueType>
+using simd_chunk_reduce_analysis = Kokkos::Impl::FunctorAnalysis<
+    Kokkos::Impl::FunctorPatternInterface::REDUCE, Kokkos::RangePolicy<>,
+    Functor, ValueType>;
+
+template <class Functor>
+class SimdChunkReduceBase {
+ protected:
+  Functor m_functor;
+
+  explicit SimdChunkReduceBase(Functor const& functor_arg)
+      : m_functor(functor_arg) {}
+};
+
+template <class Functor, class ValueType,
+          bool = simd_chunk_reduce_analysis<
+              Functor, ValueType>::has_join_member_function>
+class SimdChunkReduceJoin : public SimdChunkReduceBase<Functor> {
+ protected:
+  using SimdChunkReduceBase<Functor>::SimdChunkReduceBase;
+};
+
+template <class Functor, class ValueType>
+class SimdChunkReduceJoin<Functor, ValueType, true>
+    : public SimdChunkReduceBase<Functor> {
+ protected:
+  using SimdChunkReduceBase<Functor>::SimdChunkReduceBase;
+
+ public:
+  KOKKOS_FUNCTION void join(ValueType& dst, ValueType const& src) const {
+    this->m_functor.join(dst, src);
+  }
+};
+
+template <class Functor, class ValueType,
+          bool = simd_chunk_reduce_analysis<
+              Functor, ValueType>::has_init_member_function>
+class SimdChunkReduceInit : public SimdChunkReduceJoin<Functor, ValueType> {
+ protected:
+  using SimdChunkReduceJoin<Functor, ValueType>::SimdChunkReduceJoin;
+};
+
+template <class Functor, class ValueType>
+class SimdChunkReduceInit<Functor, ValueType, true>
+    : public SimdChunkReduceJoin<Functor, ValueType> {
+ protected:
+  using SimdChunkReduceJoin<Functor, ValueType>::SimdChunkReduceJoin;
+
+ public:
+  KOKKOS_FUNCTION void init(ValueType& dst) const { this->m_functor.init(dst); }
+};
+
+template <class Functor, class ValueType,
+          bool = simd_chunk_reduce_analysis<
+              Functor, ValueType>::has_final_member_function>
+class SimdChunkReduceFinal : public SimdChunkReduceInit<Functor, ValueType> {
+ protected:
+  using SimdChunkReduceInit<Functor, ValueType>::SimdChunkReduceInit;
+};
+
+template <class Functor, class ValueType>
+class SimdChunkReduceFinal<Functor, ValueType, true>
+    : public SimdChunkReduceInit<Functor, ValueType> {
+ protected:
+  using SimdChunkReduceInit<Functor, ValueType>::SimdChunkReduceInit;
+
+ public:
+  KOKKOS_FUNCTION void final(ValueType& dst) const {
+    this->m_functor.final(dst);
+  }
+};
+
+template <class Abi, class Functor, class ValueType>
+class SimdChunkReduceFunctor
+    : public SimdChunkReduceFinal<Functor, ValueType> {
+  std::int64_t m_begin;
+  std::int64_t m_end;
+
+ public:
+  SimdChunkReduceFunctor(Functor const& functor_arg, std::int64_t begin_arg,
+                         std::int64_t end_arg)
+      : SimdChunkReduceFinal<Functor, ValueType>(functor_arg),
+        m_begin(begin_arg),
+        m_end(end_arg) {}
+  KOKKOS_FUNCTION void operator()(std::int64_t chunk,
+                                  ValueType& update) const {
+    this->m_functor(make_simd_chunk<Abi>(m_begin, m_end, chunk), update);
+  }
+};
+
+template <class ViewType>
+KOKKOS_FORCEINLINE_FUNCTION void check_simd_view() {
+  static_assert(ViewType::rank == 1,
+                "simd_load/simd_store require a rank-1 View");
+  static_assert(
+      std::is_same_v<typename ViewType::array_layout, Kokkos::LayoutLeft> ||
+          std::is_same_v<typename ViewType::array_layout, Kokkos::LayoutRight>,
+      "simd_load/simd_store require a contiguous View layout");
+}
+
+}  // namespace Impl
+
+/// Loads the lanes of chunk from a rank-1 contiguous View. Lanes past the end
+/// of the range are zero.
+template <class Abi, class ViewType>
+KOKKOS_FORCEINLINE_FUNCTION
+    simd<typename ViewType::non_const_value_type, Abi>
+    simd_load(ViewType const& view, SimdChunk<Abi> const& chunk) {
+  Impl::check_simd_view<ViewType>();
+  using value_type = typename ViewType::non_const_value_type;
+  auto const* ptr  = view.data() + chunk.begin();
+  simd<value_type, Abi> result;
+  if (chunk.is_full()) {
+    result.copy_from(ptr, element_aligned_tag());
+  } else {
+    result = value_type(0);
+    where(chunk.template mask<value_type>(), result)
+        .copy_from(ptr, element_aligned_tag());
+  }
+  return result;
+}
+
+/// Stores the lanes of chunk into a rank-1 contiguous View. Lanes past the
+/// end of the range are not written.
+template <class Abi, class ViewType>
+KOKKOS_FORCEINLINE_FUNCTION void simd_store(
+    ViewType const& view, SimdChunk<Abi> const& chunk,
+    simd<typename ViewType::non_const_value_type, Abi> const& value) {
+  Impl::check_simd_view<ViewType>();
+  auto* ptr = view.data() + chunk.begin();
+  if (chunk.is_full()) {
+    value.copy_to(ptr, element_aligned_tag());
+  } else {
+    where(chunk.template mask<typename ViewType::non_const_value_type>(),
+          value)
+        .copy_to(ptr, element_aligned_tag());
+  }
+}
+
+}  // namespace Experimental
+
+template <class ExecutionSpace, class Abi, class FunctorType>
+inline void parallel_for(
+    std::string const& label,
+    Experimental::SimdRangePolicy<ExecutionSpace, Abi> const& policy,
+    FunctorType const& functor) {
+  Kokkos::parallel_for(
+      label, policy.impl_chunk_policy(),
+      Experimental::Impl::SimdChunkForFunctor<Abi, FunctorType>(
+          functor, policy.begin(), policy.end()));
+}
+
+template <class ExecutionSpace, class Abi, class FunctorType>
+inline void parallel_for(
+    Experimental::SimdRangePolicy<ExecutionSpace, Abi> const& policy,
+    FunctorType const& functor) {
+  Kokkos::parallel_for("", policy, functor);
+}
+
+template <class ExecutionSpace, class Abi, class FunctorType, class ReturnType>
+inline void parallel_reduce(
+    std::string const& label,
+    Experimental::SimdRangePolicy<ExecutionSpace, Abi> const& policy,
+    FunctorType const& functor, ReturnType&& return_value) {
+  using value_type = typename Impl::ParallelReduceReturnValue<
+      void, std::remove_cv_t<std::remove_reference_t<ReturnType>>,
+      FunctorType>::value_type;
+  static_assert(!std::is_array_v<value_type>,
+                "SimdRangePolicy does not support array reductions");
+  Kokkos::parallel_reduce(
+      label, policy.impl_chunk_policy(),
+      Experimental::Impl::SimdChunkReduceFunctor<Abi, FunctorType,
+                                                 value_type>(
+          functor, policy.begin(), policy.end()),
+      std::forward<ReturnType>(return_value));
+}
+
+template <class ExecutionSpace, class Abi, class FunctorType, class ReturnType>
+inline void parallel_reduce(
+    Experimental::SimdRangePolicy<ExecutionSpace, Abi> const& policy,
+    FunctorType const& functor, ReturnType&& return_value) {
+  Kokkos::parallel_reduce("", policy, functor,
+                          std::forward<ReturnType>(return_value));
+}
+
+}  // namespace Kokkos
+
+#endif
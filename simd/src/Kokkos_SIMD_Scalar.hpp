@@ -222,6 +222,72 @@ KOKKOS_FORCEINLINE_FUNCTION simd<T, simd_abi::scalar> condition(
                                                         : static_cast<T>(c));
 }
 
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<T, simd_abi::scalar> permute(
+    simd<T, simd_abi::scalar> const& a,
+    simd<std::int32_t, simd_abi::scalar> const&) {
+  return a;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<T, simd_abi::scalar> compress(
+    simd_mask<T, simd_abi::scalar> const& mask,
+    simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(static_cast<bool>(mask) ? static_cast<T>(a)
+                                                           : T(0));
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<T, simd_abi::scalar> expand(
+    simd_mask<T, simd_abi::scalar> const& mask,
+    simd<T, simd_abi::scalar> const& a) {
+  return compress(mask, a);
+}
+
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION std::size_t compress_store(
+    simd_mask<T, simd_abi::scalar> const& mask,
+    simd<T, simd_abi::scalar> const& a, T* mem) {
+  if (!static_cast<bool>(mask)) return 0;
+  *mem = static_cast<T>(a);
+  return 1;
+}
+
+// simd<Kokkos::complex<double>, scalar> is the generic scalar simd above,
+// these overloads give it the same real-valued accessors as the vector Abis
+
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION
+    simd<Kokkos::complex<double>, simd_abi::scalar>
+    conj(simd<Kokkos::complex<double>, simd_abi::scalar> const& a) {
+  return simd<Kokkos::complex<double>, simd_abi::scalar>(
+      Kokkos::conj(static_cast<Kokkos::complex<double>>(a)));
+}
+
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<double, simd_abi::scalar> real(
+    simd<Kokkos::complex<double>, simd_abi::scalar> const& a) {
+  return simd<double, simd_abi::scalar>(
+      static_cast<Kokkos::complex<double>>(a).real());
+}
+
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<double, simd_abi::scalar> imag(
+    simd<Kokkos::complex<double>, simd_abi::scalar> const& a) {
+  return simd<double, simd_abi::scalar>(
+      static_cast<Kokkos::complex<double>>(a).imag());
+}
+
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<double, simd_abi::scalar> norm(
+    simd<Kokkos::complex<double>, simd_abi::scalar> const& a) {
+  Kokkos::complex<double> const value(a);
+  return simd<double, simd_abi::scalar>(value.real() * value.real() +
+                                        value.imag() * value.imag());
+}
+
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<double, simd_abi::scalar> abs(
+    simd<Kokkos::complex<double>, simd_abi::scalar> const& a) {
+  return simd<double, simd_abi::scalar>(
+      Kokkos::abs(static_cast<Kokkos::complex<double>>(a)));
+}
+
 template <class T, class Abi>
 [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> copysign(
     simd<T, Abi> const& a, simd<T, Abi> const& b) {
@@ -339,16 +405,34 @@ template <class T>
   return a == simd_mask<T, Kokkos::Experimental::simd_abi::scalar>(false);
 }
 
-template <class T>
+template <class T, class BinaryOperation>
 [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
 reduce(const_where_expression<simd_mask<T, simd_abi::scalar>,
                               simd<T, simd_abi::scalar>> const& x,
-       T identity_element, std::plus<>) {
+       T identity_element, BinaryOperation) {
   return static_cast<bool>(x.impl_get_mask())
              ? static_cast<T>(x.impl_get_value())
              : identity_element;
 }
 
+template <class T, class BinaryOperation = std::plus<>>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+reduce(simd<T, simd_abi::scalar> const& v, BinaryOperation = {}) {
+  return static_cast<T>(v);
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+hmax(simd<T, simd_abi::scalar> const& v) {
+  return static_cast<T>(v);
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+hmin(simd<T, simd_abi::scalar> const& v) {
+  return static_cast<T>(v);
+}
+
 template <class T>
 [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
 hmax(const_where_expression<simd_mask<T, simd_abi::scalar>,
@@ -487,10 +487,440 @@ KOKKOS_INLINE_FUNCTION void device_check_condition() {
   checker.truth(all_of(a == decltype(a)(16)));
 }
 
+template <class Abi, typename DataType>
+inline void host_check_reductions() {
+  using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+  using mask_type             = typename simd_type::mask_type;
+  std::size_t constexpr width = simd_type::size();
+
+  DataType args[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    args[i] = std::is_signed_v<DataType> && (i % 3 == 1) ? DataType(-int(i))
+                                                          : DataType(i + 1);
+  }
+  simd_type a;
+  a.copy_from(args, Kokkos::Experimental::element_aligned_tag());
+  mask_type mask(false);
+  for (std::size_t i = 0; i < width; i += 2) mask[i] = true;
+
+  DataType sum            = 0;
+  DataType product        = 1;
+  DataType min_value      = args[0];
+  DataType max_value      = args[0];
+  DataType masked_sum     = 0;
+  DataType masked_product = 1;
+  DataType masked_min     = Kokkos::reduction_identity<DataType>::min();
+  DataType masked_max     = Kokkos::reduction_identity<DataType>::max();
+  for (std::size_t i = 0; i < width; ++i) {
+    sum += args[i];
+    product *= args[i];
+    min_value = Kokkos::min(min_value, args[i]);
+    max_value = Kokkos::max(max_value, args[i]);
+    if (i % 2 == 0) {
+      masked_sum += args[i];
+      masked_product *= args[i];
+      masked_min = Kokkos::min(masked_min, args[i]);
+      masked_max = Kokkos::max(masked_max, args[i]);
+    }
+  }
+
+  EXPECT_EQ(reduce(a), sum);
+  EXPECT_EQ(reduce(a, std::plus<>()), sum);
+  EXPECT_EQ(reduce(a, std::multiplies<>()), product);
+  EXPECT_EQ(hmin(a), min_value);
+  EXPECT_EQ(hmax(a), max_value);
+  EXPECT_EQ(reduce(where(mask, a), DataType(0), std::plus<>()), masked_sum);
+  EXPECT_EQ(reduce(where(mask, a), DataType(1), std::multiplies<>()),
+            masked_product);
+  EXPECT_EQ(hmin(where(mask, a)), masked_min);
+  EXPECT_EQ(hmax(where(mask, a)), masked_max);
+  EXPECT_EQ(reduce(where(mask_type(false), a), DataType(0), std::plus<>()),
+            DataType(0));
+  EXPECT_EQ(reduce(where(mask_type(false), a), DataType(1),
+                   std::multiplies<>()),
+            DataType(1));
+  // inactive lanes take the identity element of every Abi
+  EXPECT_EQ(hmin(where(mask_type(false), a)),
+            Kokkos::reduction_identity<DataType>::min());
+  EXPECT_EQ(hmax(where(mask_type(false), a)),
+            Kokkos::reduction_identity<DataType>::max());
+
+  if constexpr (std::is_integral_v<DataType>) {
+    DataType bits_and   = ~DataType(0);
+    DataType bits_or    = 0;
+    DataType bits_xor   = 0;
+    DataType masked_xor = 0;
+    for (std::size_t i = 0; i < width; ++i) {
+      bits_and &= args[i];
+      bits_or |= args[i];
+      bits_xor ^= args[i];
+      if (i % 2 == 0) masked_xor ^= args[i];
+    }
+    EXPECT_EQ(reduce(a, std::bit_and<>()), bits_and);
+    EXPECT_EQ(reduce(a, std::bit_or<>()), bits_or);
+    EXPECT_EQ(reduce(a, std::bit_xor<>()), bits_xor);
+    EXPECT_EQ(reduce(where(mask, a), DataType(0), std::bit_xor<>()),
+              masked_xor);
+  }
+}
+
+template <class Abi, typename DataType>
+KOKKOS_INLINE_FUNCTION void device_check_reductions() {
+  using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+  using mask_type             = typename simd_type::mask_type;
+  std::size_t constexpr width = simd_type::size();
+  kokkos_checker checker;
+
+  DataType args[width];
+  for (std::size_t i = 0; i < width; ++i) args[i] = DataType(i + 1);
+  simd_type a;
+  a.copy_from(args, Kokkos::Experimental::element_aligned_tag());
+  mask_type mask(false);
+  for (std::size_t i = 0; i < width; i += 2) mask[i] = true;
+
+  DataType sum        = 0;
+  DataType min_value  = args[0];
+  DataType max_value  = args[0];
+  DataType masked_sum = 0;
+  for (std::size_t i = 0; i < width; ++i) {
+    sum += args[i];
+    min_value = Kokkos::min(min_value, args[i]);
+    max_value = Kokkos::max(max_value, args[i]);
+    if (i % 2 == 0) masked_sum += args[i];
+  }
+
+  checker.equality(reduce(a, std::plus<>()), sum);
+  checker.equality(hmin(a), min_value);
+  checker.equality(hmax(a), max_value);
+  checker.equality(reduce(where(mask, a), DataType(0), std::plus<>()),
+                   masked_sum);
+}
+
+template <class Abi, typename DataType>
+inline void host_check_loads_stores() {
+  using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+  using index_type            = Kokkos::Experimental::simd<std::int32_t, Abi>;
+  using mask_type             = typename simd_type::mask_type;
+  std::size_t constexpr width = simd_type::size();
+
+  DataType source[2 * width];
+  for (std::size_t i = 0; i < 2 * width; ++i) source[i] = DataType(3 * i + 1);
+  std::int32_t indices[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    indices[i] = std::int32_t(2 * (width - 1 - i));
+  }
+  index_type index;
+  index.copy_from(indices, Kokkos::Experimental::element_aligned_tag());
+  mask_type mask(false);
+  for (std::size_t i = 0; i < width; i += 2) mask[i] = true;
+
+  simd_type gathered(DataType(0));
+  where(mask, gathered).gather_from(source, index);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(gathered[i], mask[i] ? source[indices[i]] : DataType(0));
+  }
+
+  DataType scattered[2 * width] = {};
+  where(mask, gathered).scatter_to(scattered, index);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(scattered[indices[i]],
+              mask[i] ? source[indices[i]] : DataType(0));
+  }
+
+  alignas(sizeof(simd_type)) DataType aligned[width];
+  simd_type a;
+  a.copy_from(source, Kokkos::Experimental::element_aligned_tag());
+  a.copy_to(aligned, Kokkos::Experimental::vector_aligned_tag());
+  simd_type b;
+  b.copy_from(aligned, Kokkos::Experimental::vector_aligned_tag());
+  simd_type c(DataType(0));
+  where(mask, c).copy_from(aligned, Kokkos::Experimental::vector_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(aligned[i], source[i]);
+    EXPECT_EQ(b[i], source[i]);
+    EXPECT_EQ(c[i], mask[i] ? source[i] : DataType(0));
+  }
+
+  alignas(sizeof(simd_type)) DataType masked_store[width] = {};
+  where(mask, a).copy_to(masked_store,
+                         Kokkos::Experimental::vector_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(masked_store[i], mask[i] ? source[i] : DataType(0));
+  }
+}
+
+template <class Abi, typename DataType>
+KOKKOS_INLINE_FUNCTION void device_check_loads_stores() {
+  using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+  using index_type            = Kokkos::Experimental::simd<std::int32_t, Abi>;
+  using mask_type             = typename simd_type::mask_type;
+  std::size_t constexpr width = simd_type::size();
+  kokkos_checker checker;
+
+  DataType source[2 * width];
+  for (std::size_t i = 0; i < 2 * width; ++i) source[i] = DataType(3 * i + 1);
+  std::int32_t indices[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    indices[i] = std::int32_t(2 * (width - 1 - i));
+  }
+  index_type index;
+  index.copy_from(indices, Kokkos::Experimental::element_aligned_tag());
+  mask_type mask(true);
+
+  simd_type gathered(DataType(0));
+  where(mask, gathered).gather_from(source, index);
+  DataType scattered[2 * width] = {};
+  where(mask, gathered).scatter_to(scattered, index);
+  for (std::size_t i = 0; i < width; ++i) {
+    checker.equality(scattered[indices[i]], source[indices[i]]);
+  }
+}
+
+template <class Abi, typename DataType>
+inline void host_check_permute_compress() {
+  using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+  using index_type            = Kokkos::Experimental::simd<std::int32_t, Abi>;
+  using mask_type             = typename simd_type::mask_type;
+  std::size_t constexpr width = simd_type::size();
+
+  DataType values[width];
+  std::int32_t indices[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    values[i]  = DataType(2 * i + 1);
+    indices[i] = std::int32_t(width - 1 - i);
+  }
+  simd_type a;
+  a.copy_from(values, Kokkos::Experimental::element_aligned_tag());
+  index_type index;
+  index.copy_from(indices, Kokkos::Experimental::element_aligned_tag());
+  mask_type mask(false);
+  for (std::size_t i = 0; i < width; i += 2) mask[i] = true;
+  std::size_t const selected = (width + 1) / 2;
+
+  simd_type const permuted = permute(a, index);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(permuted[i], values[indices[i]]);
+  }
+
+  simd_type const compressed = compress(mask, a);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(compressed[i], i < selected ? values[2 * i] : DataType(0));
+  }
+
+  simd_type const expanded = expand(mask, compressed);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(expanded[i], mask[i] ? values[i] : DataType(0));
+  }
+
+  DataType stored[width];
+  for (std::size_t i = 0; i < width; ++i) stored[i] = DataType(7);
+  EXPECT_EQ(compress_store(mask, a, stored), selected);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(stored[i], i < selected ? values[2 * i] : DataType(7));
+  }
+}
+
+template <class Abi, typename DataType>
+KOKKOS_INLINE_FUNCTION void device_check_permute_compress() {
+  using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+  using mask_type             = typename simd_type::mask_type;
+  std::size_t constexpr width = simd_type::size();
+  kokkos_checker checker;
+
+  DataType values[width];
+  for (std::size_t i = 0; i < width; ++i) values[i] = DataType(2 * i + 1);
+  simd_type a;
+  a.copy_from(values, Kokkos::Experimental::element_aligned_tag());
+  mask_type mask(true);
+
+  simd_type const compressed = compress(mask, a);
+  simd_type const expanded   = expand(mask, compressed);
+  DataType stored[width]     = {};
+  checker.equality(compress_store(mask, a, stored), width);
+  for (std::size_t i = 0; i < width; ++i) {
+    checker.equality(compressed[i], values[i]);
+    checker.equality(expanded[i], values[i]);
+    checker.equality(stored[i], values[i]);
+  }
+}
+
+template <class Abi>
+inline void host_check_complex() {
+  using complex_type          = Kokkos::complex<double>;
+  using simd_type             = Kokkos::Experimental::simd<complex_type, Abi>;
+  using real_simd_type        = Kokkos::Experimental::simd<double, Abi>;
+  std::size_t constexpr width = simd_type::size();
+  static_assert(width == real_simd_type::size());
+
+  // divisors with power of two norms keep the quotients exact
+  complex_type lhs[width];
+  complex_type rhs[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    lhs[i] = complex_type(double(i + 1), 2.0 - double(i));
+    rhs[i] = i % 2 == 0 ? complex_type(1.0, 1.0) : complex_type(0.0, -2.0);
+  }
+  simd_type a;
+  a.copy_from(lhs, Kokkos::Experimental::element_aligned_tag());
+  simd_type b;
+  b.copy_from(rhs, Kokkos::Experimental::element_aligned_tag());
+
+  simd_type const sum            = a + b;
+  simd_type const difference     = a - b;
+  simd_type const product        = a * b;
+  simd_type const quotient       = a / b;
+  simd_type const negated        = -a;
+  simd_type const conjugate      = conj(a);
+  real_simd_type const real_part = real(a);
+  real_simd_type const imag_part = imag(a);
+  real_simd_type const magnitude = abs(a);
+  complex_type stored[width];
+  product.copy_to(stored, Kokkos::Experimental::element_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(sum[i], lhs[i] + rhs[i]);
+    EXPECT_EQ(difference[i], lhs[i] - rhs[i]);
+    EXPECT_EQ(product[i], lhs[i] * rhs[i]);
+    EXPECT_EQ(stored[i], lhs[i] * rhs[i]);
+    EXPECT_DOUBLE_EQ(quotient[i].real(), (lhs[i] / rhs[i]).real());
+    EXPECT_DOUBLE_EQ(quotient[i].imag(), (lhs[i] / rhs[i]).imag());
+    EXPECT_EQ(negated[i], -lhs[i]);
+    EXPECT_EQ(conjugate[i], Kokkos::conj(lhs[i]));
+    EXPECT_EQ(real_part[i], lhs[i].real());
+    EXPECT_EQ(imag_part[i], lhs[i].imag());
+    EXPECT_DOUBLE_EQ(magnitude[i], Kokkos::abs(lhs[i]));
+  }
+
+  if constexpr (!std::is_same_v<Abi, Kokkos::Experimental::simd_abi::scalar>) {
+    simd_type const rebuilt(real_part, imag_part);
+    for (std::size_t i = 0; i < width; ++i) EXPECT_EQ(rebuilt[i], lhs[i]);
+  }
+
+  // masked loads and stores only touch the selected lanes
+  typename simd_type::mask_type mask(false);
+  for (std::size_t i = 0; i < width; i += 2) mask[i] = true;
+  complex_type const untouched(-1.0, -1.0);
+  simd_type loaded(untouched);
+  where(mask, loaded)
+      .copy_from(lhs, Kokkos::Experimental::element_aligned_tag());
+  simd_type blended(a);
+  where(mask, blended) = b;
+  for (std::size_t i = 0; i < width; ++i) stored[i] = untouched;
+  where(mask, b).copy_to(stored, Kokkos::Experimental::element_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    if (mask[i]) {
+      EXPECT_EQ(loaded[i], lhs[i]);
+    }
+    EXPECT_EQ(blended[i], mask[i] ? rhs[i] : lhs[i]);
+    EXPECT_EQ(stored[i], mask[i] ? rhs[i] : untouched);
+  }
+
+  // the magnitude neither overflows nor underflows when it is representable
+  double const infinity = std::numeric_limits<double>::infinity();
+  complex_type const extremes[] = {
+      complex_type(3e200, -4e200), complex_type(-3e-200, 4e-200),
+      complex_type(0.0, 0.0),      complex_type(0.0, -2.0),
+      complex_type(infinity, 1.0), complex_type(-infinity, infinity)};
+  double const expected[] = {5e200, 5e-200, 0.0, 2.0, infinity, infinity};
+  for (std::size_t j = 0; j < std::size(extremes); ++j) {
+    real_simd_type const extreme_magnitude = abs(simd_type(extremes[j]));
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_DOUBLE_EQ(extreme_magnitude[i], expected[j]);
+    }
+  }
+
+  // neither does the norm of divisors above the square root of the largest
+  // double or below the one of the smallest normal double
+  complex_type const dividends[] = {
+      complex_type(1.0, 2.0),        complex_type(3e200, -4e200),
+      complex_type(1.0, 1.0),        complex_type(1.0, 2.0),
+      complex_type(-3e-200, 4e-200), complex_type(1.0, -1.0)};
+  complex_type const divisors[] = {
+      complex_type(3e200, -4e200),  complex_type(1e200, 2e200),
+      complex_type(1e160, -1e160),  complex_type(3e-200, 4e-200),
+      complex_type(1e-200, -2e-200), complex_type(1e-160, 3e-160)};
+  std::size_t constexpr num_divisions = std::size(divisors);
+  for (std::size_t j = 0; j < num_divisions; ++j) {
+    for (std::size_t i = 0; i < width; ++i) {
+      lhs[i] = dividends[(i + j) % num_divisions];
+      rhs[i] = divisors[(i + j) % num_divisions];
+    }
+    a.copy_from(lhs, Kokkos::Experimental::element_aligned_tag());
+    b.copy_from(rhs, Kokkos::Experimental::element_aligned_tag());
+    simd_type const scaled_quotient = a / b;
+    for (std::size_t i = 0; i < width; ++i) {
+      complex_type const expected_quotient = lhs[i] / rhs[i];
+      double const tolerance = 1e-14 * Kokkos::abs(expected_quotient);
+      EXPECT_NEAR(scaled_quotient[i].real(), expected_quotient.real(),
+                  tolerance);
+      EXPECT_NEAR(scaled_quotient[i].imag(), expected_quotient.imag(),
+                  tolerance);
+    }
+  }
+}
+
+template <class Abi>
+KOKKOS_INLINE_FUNCTION void device_check_complex() {
+  using complex_type = Kokkos::complex<double>;
+  using simd_type    = Kokkos::Experimental::simd<complex_type, Abi>;
+  kokkos_checker checker;
+
+  simd_type const a(complex_type(3.0, 4.0));
+  simd_type const b(complex_type(1.0, -2.0));
+  checker.equality((a * b)[0], complex_type(11.0, -2.0));
+  checker.equality(conj(a)[0], complex_type(3.0, -4.0));
+  checker.equality(real(a)[0], 3.0);
+  checker.equality(imag(a)[0], 4.0);
+  checker.equality(abs(a)[0], 5.0);
+}
+
+template <class Abi, class HalfType>
+inline void host_check_half_conversion() {
+  using simd_type             = Kokkos::Experimental::simd<double, Abi>;
+  std::size_t constexpr width = simd_type::size();
+
+  // exactly representable in binary16 and bfloat16
+  HalfType stored[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    stored[i] = HalfType(0.75 * double(i) - 1.0);
+  }
+  simd_type value;
+  Kokkos::Experimental::copy_from_half(
+      value, stored, Kokkos::Experimental::element_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(value[i], 0.75 * double(i) - 1.0);
+  }
+
+  HalfType result[width];
+  Kokkos::Experimental::copy_to_half(
+      value * 2.0, result, Kokkos::Experimental::element_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(double(result[i]), 1.5 * double(i) - 2.0);
+  }
+
+  // just above the tie between 1 and the next value, rounding through float
+  // would drop the excess and round the tie down to 1. the fallback half
+  // types are floats and do not round.
+  if constexpr (sizeof(HalfType) == sizeof(std::uint16_t)) {
+    int constexpr mantissa_bits =
+        std::is_same_v<HalfType, Kokkos::Experimental::half_t> ? 10 : 7;
+    double const above_tie =
+        1.0 + std::ldexp(1.0, -mantissa_bits - 1) + std::ldexp(1.0, -40);
+    double const next = 1.0 + std::ldexp(1.0, -mantissa_bits);
+    Kokkos::Experimental::copy_to_half(
+        simd_type(above_tie), result,
+        Kokkos::Experimental::element_aligned_tag());
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_EQ(double(result[i]), next);
+    }
+  }
+}
+
 template <typename Abi, typename... DataTypes>
 inline void host_check_math_ops_all_types(
     Kokkos::Experimental::Impl::data_types<DataTypes...>) {
   (host_check_math_ops<Abi, DataTypes>(), ...);
+  (host_check_reductions<Abi, DataTypes>(), ...);
+  (host_check_loads_stores<Abi, DataTypes>(), ...);
+  (host_check_permute_compress<Abi, DataTypes>(), ...);
 }
 
 template <class Abi>
@@ -502,12 +932,18 @@ inline void host_check_abi() {
   host_check_conversions<Abi>();
   host_check_shifts<Abi>();
   host_check_condition<Abi>();
+  host_check_complex<Abi>();
+  host_check_half_conversion<Abi, Kokkos::Experimental::half_t>();
+  host_check_half_conversion<Abi, Kokkos::Experimental::bhalf_t>();
 }
 
 template <typename Abi, typename... DataTypes>
 KOKKOS_INLINE_FUNCTION void device_check_math_ops_all_types(
     Kokkos::Experimental::Impl::data_types<DataTypes...>) {
   (device_check_math_ops<Abi, DataTypes>(), ...);
+  (device_check_reductions<Abi, DataTypes>(), ...);
+  (device_check_loads_stores<Abi, DataTypes>(), ...);
+  (device_check_permute_compress<Abi, DataTypes>(), ...);
 }
 
 template <class Abi>
@@ -519,6 +955,7 @@ KOKKOS_INLINE_FUNCTION void device_check_abi() {
   device_check_conversions<Abi>();
   device_check_shifts<Abi>();
   device_check_condition<Abi>();
+  device_check_complex<Abi>();
 }
 
 inline void host_check_abis(Kokkos::Experimental::Impl::abi_set<>) {}
@@ -555,3 +992,124 @@ TEST(simd, device) {
   Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::IndexType<int>>(0, 1),
                        simd_device_functor());
 }
+
+// a maximum with its own join, init and final, which the reduction over the
+// chunks has to call
+class simd_range_max_functor {
+ public:
+  using value_type = double;
+  using view_type  = Kokkos::View<double*, Kokkos::HostSpace>;
+
+  explicit simd_range_max_functor(view_type x_arg) : m_x(x_arg) {}
+
+  template <class Chunk>
+  void operator()(Chunk const& chunk, double& update) const {
+    auto const values = simd_load(m_x, chunk);
+    for (std::size_t lane = 0; lane < chunk.size(); ++lane) {
+      update = Kokkos::max(update, values[lane]);
+    }
+  }
+  void join(double& dst, double const& src) const {
+    dst = Kokkos::max(dst, src);
+  }
+  void init(double& dst) const {
+    dst = Kokkos::reduction_identity<double>::max();
+  }
+  void final(double& dst) const { dst = -dst; }
+
+ private:
+  view_type m_x;
+};
+
+TEST(simd, range_policy) {
+  using policy_type =
+      Kokkos::Experimental::SimdRangePolicy<Kokkos::DefaultHostExecutionSpace>;
+  using simd_type = Kokkos::Experimental::simd<double, policy_type::abi_type>;
+  using view_type = Kokkos::View<double*, Kokkos::HostSpace>;
+
+  // one full chunk past the start offset plus a partial remainder
+  int constexpr begin = 1;
+  int const end       = begin + 2 * int(policy_type::width) + 1;
+  view_type x("x", end + 1);
+  view_type y("y", end + 1);
+  for (int i = 0; i <= end; ++i) {
+    x(i) = i;
+    y(i) = -1.0;
+  }
+
+  Kokkos::parallel_for(policy_type(begin, end), [=](auto const& chunk) {
+    simd_store(y, chunk, simd_type(2.0) * simd_load(x, chunk));
+  });
+  double sum = 0.0;
+  Kokkos::parallel_reduce(
+      policy_type(begin, end),
+      [=](auto const& chunk, double& update) {
+        update += reduce(simd_load(x, chunk));
+      },
+      sum);
+
+  double expected_sum = 0.0;
+  for (int i = 0; i <= end; ++i) {
+    bool const in_range = begin <= i && i < end;
+    EXPECT_EQ(y(i), in_range ? 2.0 * i : -1.0);
+    if (in_range) expected_sum += i;
+  }
+  EXPECT_EQ(sum, expected_sum);
+
+  // x(i) is -i so that init must provide the identity of the maximum
+  for (int i = 0; i <= end; ++i) x(i) = -i;
+  double negated_max = 0.0;
+  Kokkos::parallel_reduce(policy_type(begin, end), simd_range_max_functor(x),
+                          negated_max);
+  EXPECT_EQ(negated_max, double(begin));
+
+  // the partial chunk of a complex View is loaded and stored with the masks
+  // of simd<Kokkos::complex<double>>
+  using complex_type = Kokkos::complex<double>;
+  Kokkos::View<complex_type*, Kokkos::HostSpace> z("z", end + 1);
+  for (int i = 0; i <= end; ++i) z(i) = complex_type(i, -i);
+  Kokkos::parallel_for(policy_type(begin, end), [=](auto const& chunk) {
+    auto const value = simd_load(z, chunk);
+    simd_store(z, chunk, value * value);
+  });
+  for (int i = 0; i <= end; ++i) {
+    complex_type const original(i, -i);
+    bool const in_range = begin <= i && i < end;
+    EXPECT_EQ(z(i), in_range ? original * original : original);
+  }
+}
+
+TEST(simd, dispatch) {
+  int calls = 0;
+  Kokkos::Experimental::simd_dispatch([&](auto abi) {
+    using abi_type    = decltype(abi);
+    using simd_type   = Kokkos::Experimental::simd<double, abi_type>;
+    using native_type = Kokkos::Experimental::simd_abi::Impl::host_native;
+    ++calls;
+    // the Abi of the instruction set the program is compiled for
+    EXPECT_TRUE((std::is_same_v<abi_type, native_type>));
+    EXPECT_EQ(reduce(simd_type(1.0)), double(simd_type::size()));
+  });
+  EXPECT_EQ(calls, 1);
+
+  // the order of the set does not matter
+  using native_type = Kokkos::Experimental::simd_abi::Impl::host_native;
+  Kokkos::Experimental::simd_dispatch(
+      Kokkos::Experimental::Impl::abi_set<
+          native_type, Kokkos::Experimental::simd_abi::scalar>(),
+      [&](auto abi) {
+        EXPECT_TRUE((std::is_same_v<decltype(abi), native_type>));
+        ++calls;
+      });
+  EXPECT_EQ(calls, 2);
+
+  Kokkos::Experimental::simd_dispatch(
+      Kokkos::Experimental::Impl::abi_set<
+          Kokkos::Experimental::simd_abi::scalar>(),
+      [&](auto abi) {
+        EXPECT_TRUE((std::is_same_v<decltype(abi),
+                                    Kokkos::Experimental::simd_abi::scalar>));
+        ++calls;
+      });
+  EXPECT_EQ(calls, 3);
+}
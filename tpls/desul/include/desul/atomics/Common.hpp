@@ -98,6 +98,21 @@ constexpr bool atomic_always_lock_free(std::size_t size) {
       ;
 }
 
+// Host atomics can additionally be lock-free for 16-byte aligned types
+template <class T>
+constexpr bool host_atomic_always_lock_free() {
+  return atomic_always_lock_free(sizeof(T))
+#if defined(DESUL_IMPL_HAVE_HOST_16BYTE_COMPARE_AND_SWAP)
+         || (sizeof(T) == 16 && alignof(T) >= 16)
+#endif
+      ;
+}
+
+template <class T>
+constexpr bool device_atomic_always_lock_free() {
+  return atomic_always_lock_free(sizeof(T));
+}
+
 template <std::size_t Size, std::size_t Align>
 DESUL_INLINE_FUNCTION bool atomic_is_lock_free() noexcept {
   return Size == 4 || Size == 8
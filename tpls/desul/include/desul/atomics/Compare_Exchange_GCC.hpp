@@ -12,6 +12,7 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
 #include <desul/atomics/Thread_Fence_GCC.hpp>
+#include <cstring>
 #include <type_traits>
 
 namespace desul {
@@ -30,6 +31,19 @@ struct host_atomic_exchange_available_gcc {
       std::is_trivially_copyable<T>::value;
 };
 
+// 16-byte types that do not go through __atomic_compare_exchange since it
+// would call into libatomic, which is not guaranteed to be lock-free
+template <class T>
+struct host_atomic_exchange_16byte_gcc {
+  constexpr static bool value =
+#ifdef DESUL_IMPL_HAVE_HOST_16BYTE_COMPARE_AND_SWAP
+      !host_atomic_exchange_available_gcc<T>::value && sizeof(T) == 16 &&
+      alignof(T) >= 16 && std::is_trivially_copyable<T>::value;
+#else
+      false;
+#endif
+};
+
 // clang-format off
 // Disable warning for large atomics on clang 7 and up (checked with godbolt)
 // error: large atomic operation may incur significant performance penalty [-Werror,-Watomic-alignment]
@@ -80,8 +94,56 @@ host_atomic_compare_exchange(
   return compare;
 }
 
+#ifdef DESUL_IMPL_HAVE_HOST_16BYTE_COMPARE_AND_SWAP
+__extension__ typedef unsigned __int128 host_atomic_uint128_t;
+
+// The __sync builtin is expanded inline to lock cmpxchg16b on x86-64 and to
+// casp (or an ldxp/stxp loop) on AArch64. It is a full barrier and therefore
+// satisfies every memory order.
+template <class T, class MemoryOrder, class MemoryScope>
+std::enable_if_t<host_atomic_exchange_16byte_gcc<T>::value, T>
+host_atomic_compare_exchange(T* const dest,
+                             dont_deduce_this_parameter_t<const T> compare,
+                             dont_deduce_this_parameter_t<const T> val,
+                             MemoryOrder,
+                             MemoryScope) {
+  host_atomic_uint128_t expected;
+  host_atomic_uint128_t desired;
+  std::memcpy(&expected, &compare, sizeof(T));
+  std::memcpy(&desired, &val, sizeof(T));
+  host_atomic_uint128_t const old = __sync_val_compare_and_swap(
+      reinterpret_cast<host_atomic_uint128_t*>(dest), expected, desired);
+  T return_val;
+  std::memcpy(&return_val, &old, sizeof(T));
+  return return_val;
+}
+
+template <class T, class MemoryOrder, class MemoryScope>
+std::enable_if_t<host_atomic_exchange_16byte_gcc<T>::value, T> host_atomic_exchange(
+    T* const dest,
+    dont_deduce_this_parameter_t<const T> val,
+    MemoryOrder,
+    MemoryScope) {
+  auto* const ptr = reinterpret_cast<host_atomic_uint128_t*>(dest);
+  host_atomic_uint128_t desired;
+  std::memcpy(&desired, &val, sizeof(T));
+  // the initial read may be torn, the compare-and-swap validates it
+  host_atomic_uint128_t assume = *ptr;
+  host_atomic_uint128_t old;
+  while ((old = __sync_val_compare_and_swap(ptr, assume, desired)) != assume) {
+    assume = old;
+  }
+  T return_val;
+  std::memcpy(&return_val, &old, sizeof(T));
+  return return_val;
+}
+#endif
+
 template <class T, class MemoryOrder, class MemoryScope>
-std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_exchange(
+std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value &&
+                     !host_atomic_exchange_16byte_gcc<T>::value,
+                 T>
+host_atomic_exchange(
     T* const dest,
     dont_deduce_this_parameter_t<const T> val,
     MemoryOrder /*order*/,
@@ -100,7 +162,9 @@ std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_e
 }
 
 template <class T, class MemoryOrder, class MemoryScope>
-std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T>
+std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value &&
+                     !host_atomic_exchange_16byte_gcc<T>::value,
+                 T>
 host_atomic_compare_exchange(T* const dest,
                              dont_deduce_this_parameter_t<const T> compare,
                              dont_deduce_this_parameter_t<const T> val,
@@ -21,23 +21,62 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #include <desul/atomics/Lock_Array_SYCL.hpp>
 #endif
 
+// Number of locks used by lock-based host atomics, must be a power of two
+#ifndef DESUL_ATOMICS_HOST_LOCK_ARRAY_SIZE
+#define DESUL_ATOMICS_HOST_LOCK_ARRAY_SIZE 65536
+#endif
+
+// Upper bound of the number of pause instructions between two reads of a
+// contended lock
+#ifndef DESUL_ATOMICS_HOST_LOCK_MAX_BACKOFF
+#define DESUL_ATOMICS_HOST_LOCK_MAX_BACKOFF 64
+#endif
+
 namespace desul {
 namespace Impl {
 
 struct HostLocks {
-  static constexpr uint32_t HOST_SPACE_ATOMIC_MASK = 0xFFFF;
-  static constexpr uint32_t HOST_SPACE_ATOMIC_XOR_MASK = 0x5A39;
+  static constexpr uint32_t HOST_SPACE_ATOMIC_LOCK_COUNT =
+      DESUL_ATOMICS_HOST_LOCK_ARRAY_SIZE;
+  static_assert(HOST_SPACE_ATOMIC_LOCK_COUNT > 0 &&
+                    (HOST_SPACE_ATOMIC_LOCK_COUNT &
+                     (HOST_SPACE_ATOMIC_LOCK_COUNT - 1)) == 0,
+                "DESUL_ATOMICS_HOST_LOCK_ARRAY_SIZE must be a power of two");
+  static constexpr uint32_t HOST_SPACE_ATOMIC_MASK = HOST_SPACE_ATOMIC_LOCK_COUNT - 1;
+
+  // Every lock sits on its own cache line so that threads spinning on one
+  // lock do not slow down unrelated atomics
+  struct alignas(64) PaddedLock {
+    int32_t value;
+  };
+
   template <class is_always_void = void>
-  static int32_t* get_host_locks_() {
-    static int32_t HOST_SPACE_ATOMIC_LOCKS_DEVICE[HOST_SPACE_ATOMIC_MASK + 1] = {};
+  static PaddedLock* get_host_locks_() {
+    static PaddedLock HOST_SPACE_ATOMIC_LOCKS_DEVICE[HOST_SPACE_ATOMIC_LOCK_COUNT] = {};
     return HOST_SPACE_ATOMIC_LOCKS_DEVICE;
   }
+
+  // Fibonacci hashing, the multiplication mixes all address bits into the
+  // selected ones so that neighbouring addresses use unrelated locks
+  static inline uint32_t hash_address_(void* ptr) {
+    uint64_t const product = (uint64_t(ptr) >> 2) * 0x9E3779B97F4A7C15ull;
+    return uint32_t(product >> 32) & HOST_SPACE_ATOMIC_MASK;
+  }
+
   static inline int32_t* get_host_lock_(void* ptr) {
-    return &get_host_locks_()[((uint64_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                              HOST_SPACE_ATOMIC_XOR_MASK];
+    return &get_host_locks_()[hash_address_(ptr)].value;
   }
 };
 
+// Spin-wait hint for the processor while a lock is held by another thread
+inline void host_lock_pause() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+  __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
 inline void init_lock_arrays() {
   static bool is_initialized = false;
   if (!is_initialized) {
@@ -76,8 +115,16 @@ inline void ensure_lock_arrays_on_device() {
 
 template <class MemoryScope>
 bool lock_address(void* ptr, MemoryScope ms) {
-  return 0 == atomic_exchange(
-                  HostLocks::get_host_lock_(ptr), int32_t(1), MemoryOrderSeqCst(), ms);
+  int32_t* const lock = HostLocks::get_host_lock_(ptr);
+  if (0 == atomic_exchange(lock, int32_t(1), MemoryOrderSeqCst(), ms)) return true;
+  // Test-and-test-and-set: wait with exponential backoff until the lock looks
+  // free before the caller retries, plain reads keep the cache line shared
+  for (int delay = 1; delay <= DESUL_ATOMICS_HOST_LOCK_MAX_BACKOFF &&
+                      *static_cast<volatile int32_t*>(lock) != 0;
+       delay *= 2) {
+    for (int i = 0; i < delay; ++i) host_lock_pause();
+  }
+  return false;
 }
 
 template <class MemoryScope>
@@ -67,6 +67,15 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #define DESUL_HAVE_MSVC_ATOMICS
 #endif
 
+// Host double-width compare-and-swap for 16-byte aligned types, lock cmpxchg16b
+// on x86-64 (requires -mcx16, implied by the -march flags of all supported
+// architectures) and casp or ldxp/stxp on AArch64
+#if defined(DESUL_HAVE_GCC_ATOMICS) && !defined(DESUL_HAVE_LIBATOMIC) && \
+    defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) &&                     \
+    (defined(__x86_64__) || defined(__aarch64__))
+#define DESUL_IMPL_HAVE_HOST_16BYTE_COMPARE_AND_SWAP
+#endif
+
 #if defined(DESUL_HAVE_CUDA_ATOMICS) || defined(DESUL_HAVE_HIP_ATOMICS)
 #define DESUL_FORCEINLINE_FUNCTION inline __host__ __device__
 #define DESUL_INLINE_FUNCTION inline __host__ __device__